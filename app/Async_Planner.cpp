@@ -0,0 +1,448 @@
+/**
+ * @file Async_Planner.cpp
+ * @brief This file contains the code for Async_Planner class which plans
+ * on a background thread and streams committed path prefixes.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* --Includes-- */
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "../include/Async_Planner.h"
+
+/**
+ * @brief Constructor for class Job, called by Async_Planner::Submit
+ * @param Start_ of type Vec3i struct stores the Start Node
+ * @param Goal_ of type Vec3i struct stores the Goal Node
+ * @param On_Commit_ is called with the committed path, may be empty
+ */
+Async_Planner::Job::Job(Vec3i Start_, Vec3i Goal_,
+                        std::function<void(const std::vector<Vec3i>&)>
+                            On_Commit_)
+    : Start(Start_),
+      Goal(Goal_),
+      On_Commit(std::move(On_Commit_)),
+      State(Queued),
+      Lower(0),
+      Upper(-1),
+      Stop(false) {
+}
+
+/**
+ * @brief Get_Status gives the progress of the query
+ * @return Status of the query
+ */
+Async_Planner::Job::Status Async_Planner::Job::Get_Status() const {
+  std::lock_guard<std::mutex> Guard(Lock);
+  return State;
+}
+
+/**
+ * @brief Cancel asks the planner thread to stop the query. A query which
+ * has not started yet is cancelled at once.
+ * @return void
+ */
+void Async_Planner::Job::Cancel() {
+  Stop = true;
+  std::lock_guard<std::mutex> Guard(Lock);
+  if (State == Queued) {
+    State = Cancelled;
+    Changed.notify_all();
+  }
+}
+
+/**
+ * @brief Committed gives the path which is certain to begin the final path
+ * @return vector of Vec3i type from the Start
+ */
+std::vector<Vec3i> Async_Planner::Job::Committed() const {
+  std::lock_guard<std::mutex> Guard(Lock);
+  return Prefix;
+}
+
+/**
+ * @brief Best gives the greedy path to the Goal, or the final path once it
+ * is found
+ * @param Lower_Bound_ is set to a lower bound of the final path cost if not
+ * null
+ * @param Upper_Bound_ is set to an upper bound of the final path cost if
+ * not null, -1 while no path is known
+ * @return vector of Vec3i type from the Start, empty while no path is known
+ */
+std::vector<Vec3i> Async_Planner::Job::Best(int *Lower_Bound_,
+                                            int *Upper_Bound_) const {
+  std::lock_guard<std::mutex> Guard(Lock);
+  if (Lower_Bound_ != nullptr) {
+    *Lower_Bound_ = Lower;
+  }
+  if (Upper_Bound_ != nullptr) {
+    *Upper_Bound_ = Upper;
+  }
+  return Best_Path;
+}
+
+/**
+ * @brief Wait_Best waits for the greedy path or the end of the query
+ * @param Lower_Bound_ is set to a lower bound of the final path cost if not
+ * null
+ * @param Upper_Bound_ is set to an upper bound of the final path cost if
+ * not null, -1 if no path was found
+ * @return vector of Vec3i type from the Start, empty if no path was found
+ */
+std::vector<Vec3i> Async_Planner::Job::Wait_Best(int *Lower_Bound_,
+                                                 int *Upper_Bound_) const {
+  std::unique_lock<std::mutex> Guard(Lock);
+  Changed.wait(Guard, [&]() {
+    return !Best_Path.empty() || (State != Queued && State != Running);
+  });
+  if (Lower_Bound_ != nullptr) {
+    *Lower_Bound_ = Lower;
+  }
+  if (Upper_Bound_ != nullptr) {
+    *Upper_Bound_ = Upper;
+  }
+  return Best_Path;
+}
+
+/**
+ * @brief Wait_Committed waits for the committed path to reach a length
+ * @param Length_ of type size_t stores the number of Nodes to wait for
+ * @return vector of Vec3i type with the committed path
+ */
+std::vector<Vec3i> Async_Planner::Job::Wait_Committed(
+    std::size_t Length_) const {
+  std::unique_lock<std::mutex> Guard(Lock);
+  Changed.wait(Guard, [&]() {
+    return Prefix.size() >= Length_ || (State != Queued && State != Running);
+  });
+  return Prefix;
+}
+
+/**
+ * @brief Wait waits for the query to end
+ * @return vector of Vec3i type from Start to Goal, empty if none was found
+ */
+std::vector<Vec3i> Async_Planner::Job::Wait() const {
+  std::unique_lock<std::mutex> Guard(Lock);
+  Changed.wait(Guard, [&]() {
+    return State != Queued && State != Running;
+  });
+  return (State == Found) ? Prefix : std::vector<Vec3i>();
+}
+
+/** Destructor for Job Class */
+Async_Planner::Job::~Job() {
+}
+
+/**
+ * @brief Constructor for class Async_Planner, starts the planner thread
+ * @param Plan_ is the Planner whose World, Obstacles and Directions are used
+ */
+Async_Planner::Async_Planner(const Planner& Plan_)
+    : Commit_Interval(1024),
+      Search(Plan_),
+      Stamp(Search.Map.Size(), 0),
+      Resolved(Search.Map.Size(), 0),
+      Round(0),
+      Stopping(false) {
+  Worker = std::thread(&Async_Planner::Run, this);
+}
+
+/**
+ * @brief Submit queues a query for the planner thread
+ * @param Start_ of type Vec3i struct stores the Start Node
+ * @param Goal_ of type Vec3i struct stores the Goal Node
+ * @param On_Commit_ is called with the committed path every time it grows
+ * @return shared pointer to the Job of the query
+ */
+std::shared_ptr<Async_Planner::Job> Async_Planner::Submit(
+    Vec3i Start_, Vec3i Goal_,
+    std::function<void(const std::vector<Vec3i>&)> On_Commit_) {
+  std::shared_ptr<Job> Query(new Job(Start_, Goal_, std::move(On_Commit_)));
+  {
+    std::lock_guard<std::mutex> Guard(Queue_Mutex);
+    Queue.push_back(Query);
+  }
+  Queue_Ready.notify_one();
+  return Query;
+}
+
+/**
+ * @brief Run takes Jobs off the queue until the destructor stops it
+ * @return void
+ */
+void Async_Planner::Run() {
+  for (;;) {
+    {
+      std::unique_lock<std::mutex> Guard(Queue_Mutex);
+      Queue_Ready.wait(Guard, [&]() { return Stopping || !Queue.empty(); });
+      if (Stopping) {
+        return;
+      }
+      Current = Queue.front();
+      Queue.pop_front();
+    }
+    Plan(Current.get());
+    std::lock_guard<std::mutex> Guard(Queue_Mutex);
+    Current.reset();
+  }
+}
+
+/**
+ * @brief Plan runs the search of one Job. The greedy path is published
+ * first, then Commit runs between expansions of the optimal search through
+ * Integer_Planner::Progress, which also stops a cancelled search.
+ * @param Job_ is the Job to run
+ * @return void
+ */
+void Async_Planner::Plan(Job *Job_) {
+  {
+    std::lock_guard<std::mutex> Guard(Job_->Lock);
+    if (Job_->State == Job::Cancelled) {
+      return;
+    }
+    Job_->State = Job::Running;
+    if (!Search.Map.Is_Occupied(Job_->Start)) {
+      Job_->Prefix.assign(1, Job_->Start);
+    }
+    Job_->Lower = Integer_Planner::Heuristic(Job_->Start, Job_->Goal);
+    Job_->Changed.notify_all();
+  }
+  if (Job_->On_Commit && !Job_->Prefix.empty()) {
+    Job_->On_Commit(Job_->Prefix);
+  }
+  std::vector<Vec3i> Greedy_Path;
+  int Upper = Greedy(Job_, &Greedy_Path);
+  if (Upper >= 0) {
+    std::lock_guard<std::mutex> Guard(Job_->Lock);
+    Job_->Best_Path = Greedy_Path;
+    Job_->Upper = Upper;
+    Job_->Changed.notify_all();
+  }
+  Search.Progress = [&]() {
+    if (Job_->Stop) {
+      return false;
+    }
+    Commit(Job_, Upper);
+    return true;
+  };
+  Search.Progress_Interval = Commit_Interval;
+  std::vector<Vec3i> path = Search.findPath(Job_->Start, Job_->Goal);
+  Search.Progress = nullptr;
+  std::reverse(path.begin(), path.end());
+  /**
+   * Progress only sees Stop every Commit_Interval expansions, so a search
+   * cancelled since then may still have finished. The last call ends before
+   * Wait returns.
+   */
+  if (Job_->On_Commit && !path.empty() && !Job_->Stop) {
+    Job_->On_Commit(path);
+  }
+  {
+    std::lock_guard<std::mutex> Guard(Job_->Lock);
+    if (Search.Cancelled || Job_->Stop) {
+      Job_->State = Job::Cancelled;
+    } else if (path.empty()) {
+      Job_->State = Job::Not_Found;
+    } else {
+      Job_->State = Job::Found;
+      Job_->Prefix = path;
+      Job_->Best_Path = path;
+      Job_->Lower = Job_->Upper = Search.Cost;
+    }
+    Job_->Changed.notify_all();
+  }
+}
+
+/**
+ * @brief Greedy expands the Node closest to the Goal first, ties prefer the
+ * higher G and then the lower Cell. It reaches the Goal after far fewer
+ * expansions than A* in most worlds, but its path is not optimal.
+ * @param Job_ is the running Job
+ * @param path_ is set to the path from the Start if one is found
+ * @return int cost of the path, -1 if none was found or the Job stopped
+ */
+int Async_Planner::Greedy(Job *Job_, std::vector<Vec3i> *path_) {
+  if (Search.Map.Is_Occupied(Job_->Start)
+      || Search.Map.Is_Occupied(Job_->Goal)) {
+    return -1;
+  }
+  /** Items are H, negated G and Cell, the least one on top */
+  typedef std::tuple<int, int, std::size_t> Item;
+  std::priority_queue<Item, std::vector<Item>, std::greater<Item>> Frontier;
+  std::vector<int> Greedy_G(Search.Map.Size(), -1);
+  std::vector<std::size_t> Greedy_Parent(Search.Map.Size(), 0);
+  std::size_t Start_Cell = Search.Map.Index(Job_->Start);
+  std::size_t Goal_Cell = Search.Map.Index(Job_->Goal);
+  Greedy_G[Start_Cell] = 0;
+  Greedy_Parent[Start_Cell] = Start_Cell;
+  Frontier.emplace(Integer_Planner::Heuristic(Job_->Start, Job_->Goal), 0,
+                   Start_Cell);
+  while (!Frontier.empty()) {
+    if (Job_->Stop) {
+      return -1;
+    }
+    std::size_t Cell = std::get<2>(Frontier.top());
+    Frontier.pop();
+    if (Cell == Goal_Cell) {
+      path_->clear();
+      for (;; Cell = Greedy_Parent[Cell]) {
+        path_->push_back(Search.Map.Coordinates(Cell));
+        if (Greedy_Parent[Cell] == Cell) {
+          break;
+        }
+      }
+      std::reverse(path_->begin(), path_->end());
+      return Greedy_G[Goal_Cell];
+    }
+    Vec3i coordinates = Search.Map.Coordinates(Cell);
+    for (std::size_t i = 0; i < Search.direction.size(); ++i) {
+      Vec3i newCoordinates = {coordinates.x + Search.direction[i].x,
+        coordinates.y + Search.direction[i].y,
+        coordinates.z + Search.direction[i].z};
+      if (Search.Map.Is_Occupied(newCoordinates)) {
+        continue;
+      }
+      std::size_t Next = Search.Map.Index(newCoordinates);
+      if (Greedy_G[Next] >= 0) {
+        continue;
+      }
+      Greedy_G[Next] = Greedy_G[Cell] + Search.Step_Costs[i];
+      Greedy_Parent[Next] = Cell;
+      Frontier.emplace(Integer_Planner::Heuristic(newCoordinates, Job_->Goal),
+                       -Greedy_G[Next], Next);
+    }
+  }
+  return -1;
+}
+
+/**
+ * @brief Commit finds the longest common prefix of the Parent chains of
+ * the Open Nodes whose F value is at most the greedy cost. The final path
+ * leaves the Closed Nodes through such a Node, since its G value along the
+ * final path is already known and F never decreases along the path. Other
+ * Open Nodes are never expanded before the Goal. The chain of one Open Node
+ * is stamped with the index of each of its Nodes. Every other chain is
+ * followed up to the first stamped Node, and the Nodes on the way are
+ * stamped with that index, so each Node is visited once per Commit.
+ * @param Job_ is the running Job
+ * @param Upper_ of type int stores the greedy cost, -1 if there is none
+ * @return void
+ */
+void Async_Planner::Commit(Job *Job_, int Upper_) {
+  if (++Round == 0) {
+    std::fill(Stamp.begin(), Stamp.end(), 0);
+    Round = 1;
+  }
+  std::vector<std::size_t> Open_Cells;
+  Search.Open.For_Each([&](const Bucket_Queue::Entry& entry_) {
+    if (!Search.Is_Open(entry_)) {
+      return;
+    }
+    if (Upper_ >= 0 && entry_.G + Integer_Planner::Heuristic(
+            Search.Map.Coordinates(entry_.Cell), Job_->Goal) > Upper_) {
+      return;
+    }
+    Open_Cells.push_back(entry_.Cell);
+  });
+  if (Open_Cells.empty()) {
+    return;
+  }
+  std::sort(Open_Cells.begin(), Open_Cells.end());  ///< Independent of heap
+
+  /** Stamp the chain of the first Open Node */
+  std::vector<std::size_t> Chain_Cells;
+  for (std::size_t Cell = Open_Cells[0]; ; Cell = Search.Parent[Cell]) {
+    Chain_Cells.push_back(Cell);
+    if (Search.Parent[Cell] == Cell) {
+      break;
+    }
+  }
+  std::reverse(Chain_Cells.begin(), Chain_Cells.end());
+  for (std::size_t i = 0; i < Chain_Cells.size(); ++i) {
+    Stamp[Chain_Cells[i]] = Round;
+    Resolved[Chain_Cells[i]] = static_cast<int>(i);
+  }
+  /** Only the planner thread writes Prefix, so it may read it unlocked */
+  std::size_t Known = Job_->Prefix.size();
+  int Limit = static_cast<int>(Chain_Cells.size()) - 1;
+  std::vector<std::size_t> Visited;
+  for (std::size_t i = 1; i < Open_Cells.size()
+      && static_cast<std::size_t>(Limit) + 1 > Known; ++i) {
+    std::size_t Cell = Open_Cells[i];
+    while (Stamp[Cell] != Round) {
+      Visited.push_back(Cell);
+      Cell = Search.Parent[Cell];
+    }
+    for (std::size_t visited : Visited) {
+      Stamp[visited] = Round;
+      Resolved[visited] = Resolved[Cell];
+    }
+    Visited.clear();
+    Limit = std::min(Limit, Resolved[Cell]);
+  }
+
+  std::vector<Vec3i> Grown;
+  {
+    std::lock_guard<std::mutex> Guard(Job_->Lock);
+    if (static_cast<std::size_t>(Limit) + 1 > Known) {
+      Job_->Prefix.clear();
+      for (int i = 0; i <= Limit; ++i) {
+        Job_->Prefix.push_back(Search.Map.Coordinates(Chain_Cells[i]));
+      }
+      Grown = Job_->Prefix;
+    }
+    Job_->Lower = std::max(Job_->Lower, Search.Open.Least_F);
+    Job_->Changed.notify_all();
+  }
+  if (Job_->On_Commit && !Grown.empty()) {
+    Job_->On_Commit(Grown);
+  }
+}
+
+/**
+ * @brief Destructor for Async_Planner Class. Cancels the running and
+ * queued Jobs and stops the planner thread.
+ */
+Async_Planner::~Async_Planner() {
+  {
+    std::lock_guard<std::mutex> Guard(Queue_Mutex);
+    Stopping = true;
+    for (auto& query : Queue) {
+      query->Cancel();
+    }
+    Queue.clear();
+    if (Current) {
+      Current->Stop = true;
+    }
+  }
+  Queue_Ready.notify_all();
+  Worker.join();
+}
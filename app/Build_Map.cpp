@@ -30,8 +30,6 @@
  */
 
 /* --Includes-- */
-#include <iostream>
-#include <cmath>
 #include <vector>
 #include "../include/Build_Map.h"
 
@@ -41,18 +39,22 @@
  * @param xy_res has type double and stores x,y resolution
  * @param z_res has type double and stores z resolution
  * @param margin has type double and stores the margin value for Robot Dimensions
- * @param World has type double vector and stores World Dimensions
+ * @param Geometry has type Grid_Geometry and is built from the values above
+ * @param World has type double vector and stores World Dimensions, every
+ * member is read from Geometry so they cannot disagree
  */
-Build_Map::Build_Map(std::vector<double> _Boundary, double _xy_res,
+Build_Map::Build_Map(const std::vector<double>& _Boundary, double _xy_res,
                      double _z_res, double _margin)
-    : Boundary(_Boundary),
-      xy_res(_xy_res),
-      z_res(_z_res),
-      margin(_margin) {
-  int World_X = (Boundary[3] - Boundary[0]) / xy_res;  ///< X Dimension
-  int World_Y = (Boundary[4] - Boundary[1]) / xy_res;  ///< Y Dimension
-  int World_Z = (Boundary[5] - Boundary[2]) / z_res;  ///< Z Dimension
-  World = {World_X, World_Y, World_Z};
+    : Geometry({{_Boundary[0], _Boundary[1], _Boundary[2]},
+                {_Boundary[3], _Boundary[4], _Boundary[5]}},
+               _xy_res, _z_res, _margin),
+      Boundary({Geometry.Boundary.Min.x, Geometry.Boundary.Min.y,
+                Geometry.Boundary.Min.z, Geometry.Boundary.Max.x,
+                Geometry.Boundary.Max.y, Geometry.Boundary.Max.z}),
+      World({Geometry.World.x, Geometry.World.y, Geometry.World.z}),
+      xy_res(Geometry.Resolution.x),
+      z_res(Geometry.Resolution.z),
+      margin(Geometry.margin) {
 }
 
 /**
@@ -71,25 +73,11 @@ std::vector<int> Build_Map::World_Dimensions() {
  * representation in Discretized Workspace
  * @return Obstacle_Extrema of type double vector
  */
-std::vector<int> Build_Map::Build_Obstacle(std::vector<double> v) {
-  int minx = std::max(
-      static_cast<int>(std::floor(((v[0] - Boundary[0] - margin) / xy_res))),
-      0);
-  int miny = std::max(
-      static_cast<int>(std::floor(((v[1] - Boundary[1] - margin) / xy_res))),
-      0);
-  int minz = std::max(
-      static_cast<int>(std::floor(((v[2] - Boundary[2] - margin) / z_res))), 0);
-  int maxx = std::min(
-      static_cast<int>(std::ceil(((v[3] - Boundary[0] + margin) / xy_res))),
-      World[0]);
-  int maxy = std::min(
-      static_cast<int>(std::ceil(((v[4] - Boundary[1] + margin) / xy_res))),
-      World[1]);
-  int maxz = std::min(
-      static_cast<int>(std::ceil(((v[5] - Boundary[2] + margin) / z_res))),
-      World[2]);
-  std::vector<int> Obstacle_Extrema = { minx, miny, minz, maxx, maxy, maxz };
+std::vector<int> Build_Map::Build_Obstacle(const std::vector<double>& v) {
+  Box3i Extrema = Geometry.Obstacle_Cells({{v[0], v[1], v[2]},
+                                           {v[3], v[4], v[5]}});
+  std::vector<int> Obstacle_Extrema = { Extrema.Min.x, Extrema.Min.y,
+      Extrema.Min.z, Extrema.Max.x, Extrema.Max.y, Extrema.Max.z };
   return Obstacle_Extrema;
 }
 
@@ -102,11 +90,9 @@ std::vector<int> Build_Map::Build_Obstacle(std::vector<double> v) {
  * point in Discretized Workspace
  * @return Built_Node of type integer vector
  */
-std::vector<int> Build_Map::Build_Node(std::vector<double> Discrete) {
-  int X_Init = (Discrete[0] - Boundary[0]) / xy_res;
-  int Y_Init = (Discrete[1] - Boundary[1]) / xy_res;
-  int Z_Init = (Discrete[2] - Boundary[2]) / z_res;
-  std::vector<int> Built_Node = { X_Init, Y_Init, Z_Init };
+std::vector<int> Build_Map::Build_Node(const std::vector<double>& Discrete) {
+  Vec3i Cell = Geometry.To_Cell({Discrete[0], Discrete[1], Discrete[2]});
+  std::vector<int> Built_Node = { Cell.x, Cell.y, Cell.z };
   return Built_Node;
 }
 
@@ -119,12 +105,10 @@ std::vector<int> Build_Map::Build_Node(std::vector<double> Discrete) {
  * values of a point in World.
  * @return Coordinates_Generated of type double vector
  */
-std::vector<double> Build_Map::Get_Coordinate(std::vector<int> Node_Init) {
-  double X_Coordinate = Boundary[0] + (Node_Init[0] * xy_res);
-  double Y_Coordinate = Boundary[1] + (Node_Init[1] * xy_res);
-  double Z_Coordinate = Boundary[2] + (Node_Init[2] * z_res);
-  std::vector<double> Coordinates_Generated = { X_Coordinate, Y_Coordinate,
-      Z_Coordinate };
+std::vector<double> Build_Map::Get_Coordinate(
+    const std::vector<int>& Node_Init) {
+  Vec3d Point = Geometry.To_Point({Node_Init[0], Node_Init[1], Node_Init[2]});
+  std::vector<double> Coordinates_Generated = { Point.x, Point.y, Point.z };
   return Coordinates_Generated;
 }
 
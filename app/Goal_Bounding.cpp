@@ -0,0 +1,410 @@
+/**
+ * @file Goal_Bounding.cpp
+ * @brief This file contains the code for Goal_Bounding class which
+ * precomputes, for every free Node and direction, the box of Goals that
+ * move leads to optimally, and stores the boxes in a compressed table.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* --Includes-- */
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "../include/Goal_Bounding.h"
+#include "../include/Occupancy_Map.h"
+
+namespace {
+
+/**
+ * @brief Header of type Struct starts a saved table. It is followed by the
+ * palette of boxes and then by one palette index per Node and direction.
+ */
+struct Header {
+  char Magic[4];  ///< "AGB1"
+  uint32_t Directions;  ///< Directions per Node
+  int32_t World[3];  ///< World Dimensions
+  uint32_t Reserved;  ///< Keeps the arrays 8 byte aligned
+  uint64_t Palette_Size;  ///< Number of boxes
+  uint64_t Index_Size;  ///< Number of indices
+};
+
+/** Empty_Box contains no Node */
+const Goal_Bounding::Box16 Empty_Box = { { 0xFFFF, 0xFFFF, 0xFFFF },
+  { 0, 0, 0 } };
+
+/**
+ * @brief Box_Key of type Struct packs the six corners of a box into two
+ * words so boxes can be looked up while building the palette
+ */
+struct Box_Key {
+  uint64_t First, Second;
+  bool operator==(const Box_Key& other_) const {
+    return First == other_.First && Second == other_.Second;
+  }
+};
+
+/**
+ * @brief Box_Hash hashes a Box_Key
+ */
+struct Box_Hash {
+  std::size_t operator()(const Box_Key& key_) const {
+    return std::hash<uint64_t>()(key_.First * 0x9E3779B97F4A7C15ULL
+                                 ^ key_.Second);
+  }
+};
+
+}  // namespace
+
+/**
+ * @brief Constructor for class Goal_Bounding, the table starts empty
+ */
+Goal_Bounding::Goal_Bounding()
+    : World_Size({0, 0, 0}),
+      Directions(0),
+      Palette_Size(0),
+      Palette(nullptr),
+      Index(nullptr),
+      Mapped(nullptr),
+      Mapped_Bytes(0) {
+}
+
+/**
+ * @brief Build floods the map from every free Node with Dijkstra. Every
+ * Node reached is added to the box of the first move of its shortest path.
+ * Sources are handed out to the threads through an atomic counter and each
+ * thread writes only the rows of its own sources.
+ * @param Plan_ is the Planner whose World, Obstacles and Directions are used
+ * @param Threads_ of type int stores the number of threads, 0 uses all
+ * hardware threads
+ * @return void, the table stays empty if the World or Directions do not
+ * fit the 16 bit boxes and 8 bit first moves
+ */
+void Goal_Bounding::Build(const Planner& Plan_, int Threads_) {
+  Unmap();
+  const Vec3i& Limits = Plan_.World_Size;
+  if (Plan_.direction.empty() || Plan_.direction.size() > 256
+      || Limits.x <= 0 || Limits.x > 0xFFFF || Limits.y <= 0
+      || Limits.y > 0xFFFF || Limits.z <= 0 || Limits.z > 0xFFFF) {
+    return;
+  }
+  Occupancy_Map Map(Plan_.World_Size);
+  Map.Add_Obstacles(Plan_);
+  World_Size = Plan_.World_Size;
+  Directions = static_cast<int>(Plan_.direction.size());
+  const std::size_t Size = Map.Size();
+  std::vector<Box16> Raw(Size * Directions, Empty_Box);
+  std::vector<int> Step_Costs;
+  for (const Vec3i& move : Plan_.direction) {
+    Step_Costs.push_back(Planner::Step_Cost(move));
+  }
+
+  std::atomic<std::size_t> Next_Source(0);
+  auto Flood = [&]() {
+    std::vector<int> Dist(Size, std::numeric_limits<int>::max());
+    std::vector<uint8_t> First(Size, 0);
+    std::vector<std::size_t> Reached;
+    typedef std::pair<int, std::size_t> Item;
+    std::priority_queue<Item, std::vector<Item>, std::greater<Item>> Open;
+    for (std::size_t Source = Next_Source++; Source < Size;
+        Source = Next_Source++) {
+      if (Map.Cells[Source] != 0) {
+        continue;
+      }
+      Dist[Source] = 0;
+      Reached.push_back(Source);
+      Open.push({0, Source});
+      while (!Open.empty()) {
+        Item current = Open.top();
+        Open.pop();
+        if (current.first > Dist[current.second]) {
+          continue;
+        }
+        Vec3i coordinates = Map.Coordinates(current.second);
+        for (int i = 0; i < Directions; ++i) {
+          Vec3i newCoordinates = {coordinates.x + Plan_.direction[i].x,
+            coordinates.y + Plan_.direction[i].y,
+            coordinates.z + Plan_.direction[i].z};
+          if (Map.Is_Occupied(newCoordinates)) {
+            continue;
+          }
+          std::size_t Cell = Map.Index(newCoordinates);
+          int Total_Cost = current.first + Step_Costs[i];
+          if (Total_Cost < Dist[Cell]) {
+            if (Dist[Cell] == std::numeric_limits<int>::max()) {
+              Reached.push_back(Cell);
+            }
+            Dist[Cell] = Total_Cost;
+            First[Cell] = (current.second == Source) ? i
+                : First[current.second];
+            Open.push({Total_Cost, Cell});
+          }
+        }
+      }
+      /** Grow the box of the first move towards every reached Node */
+      for (std::size_t Cell : Reached) {
+        if (Cell != Source) {
+          Vec3i Goal = Map.Coordinates(Cell);
+          Box16& Bounds = Raw[Source * Directions + First[Cell]];
+          const int Axis_Value[3] = { Goal.x, Goal.y, Goal.z };
+          for (int Axis = 0; Axis < 3; ++Axis) {
+            uint16_t Value = static_cast<uint16_t>(Axis_Value[Axis]);
+            Bounds.Min[Axis] = std::min(Bounds.Min[Axis], Value);
+            Bounds.Max[Axis] = std::max(Bounds.Max[Axis], Value);
+          }
+        }
+        Dist[Cell] = std::numeric_limits<int>::max();
+      }
+      Reached.clear();
+    }
+  };
+  if (Threads_ <= 0) {
+    Threads_ = std::max(1, static_cast<int>(
+        std::thread::hardware_concurrency()));
+  }
+  std::vector<std::thread> Threads;
+  for (int i = 1; i < Threads_; ++i) {
+    Threads.emplace_back(Flood);
+  }
+  Flood();
+  for (auto& thread : Threads) {
+    thread.join();
+  }
+
+  /** Compress the table into a palette of distinct boxes */
+  std::unordered_map<Box_Key, uint32_t, Box_Hash> Known;
+  Owned_Palette.assign(1, Empty_Box);
+  Owned_Index.assign(Raw.size(), 0);
+  for (std::size_t i = 0; i < Raw.size(); ++i) {
+    const Box16& Bounds = Raw[i];
+    if (Bounds.Min[0] > Bounds.Max[0]) {
+      continue;  ///< Empty boxes use index 0
+    }
+    Box_Key Key = {
+      (static_cast<uint64_t>(Bounds.Min[0]) << 48)
+          | (static_cast<uint64_t>(Bounds.Min[1]) << 32)
+          | (static_cast<uint64_t>(Bounds.Min[2]) << 16) | Bounds.Max[0],
+      (static_cast<uint64_t>(Bounds.Max[1]) << 16) | Bounds.Max[2] };
+    auto found = Known.find(Key);
+    if (found == Known.end()) {
+      found = Known.emplace(Key, static_cast<uint32_t>(
+          Owned_Palette.size())).first;
+      Owned_Palette.push_back(Bounds);
+    }
+    Owned_Index[i] = found->second;
+  }
+  Palette = Owned_Palette.data();
+  Index = Owned_Index.data();
+  Palette_Size = Owned_Palette.size();
+}
+
+/**
+ * @brief Save writes the header, palette and indices to a file
+ * @param File_ has type string and stores the file name
+ * @return true if the file was written
+ */
+bool Goal_Bounding::Save(const std::string& File_) const {
+  if (Empty()) {
+    return false;
+  }
+  Header Head;
+  std::memcpy(Head.Magic, "AGB1", 4);
+  Head.Directions = static_cast<uint32_t>(Directions);
+  Head.World[0] = World_Size.x;
+  Head.World[1] = World_Size.y;
+  Head.World[2] = World_Size.z;
+  Head.Reserved = 0;
+  Head.Palette_Size = Palette_Size;
+  Head.Index_Size = static_cast<uint64_t>(World_Size.x) * World_Size.y
+      * World_Size.z * Directions;
+  std::ofstream Out(File_, std::ios::binary);
+  Out.write(reinterpret_cast<const char*>(&Head), sizeof(Head));
+  Out.write(reinterpret_cast<const char*>(Palette),
+            Head.Palette_Size * sizeof(Box16));
+  if ((Head.Palette_Size * sizeof(Box16)) % 8 != 0) {
+    const char Padding[8] = { 0 };
+    Out.write(Padding, 8 - (Head.Palette_Size * sizeof(Box16)) % 8);
+  }
+  Out.write(reinterpret_cast<const char*>(Index),
+            Head.Index_Size * sizeof(uint32_t));
+  return static_cast<bool>(Out);
+}
+
+/**
+ * @brief Load maps a saved table read only into memory. Every index is
+ * checked against the palette once, so a corrupt file is rejected rather
+ * than read out of bounds by queries.
+ * @param File_ has type string and stores the file name
+ * @return true if the file was mapped and is a valid table
+ */
+bool Goal_Bounding::Load(const std::string& File_) {
+  Unmap();
+  Owned_Palette.clear();
+  Owned_Index.clear();
+  int File = open(File_.c_str(), O_RDONLY);
+  if (File < 0) {
+    return false;
+  }
+  struct stat Status;
+  void *Data = MAP_FAILED;
+  if (fstat(File, &Status) == 0
+      && static_cast<std::size_t>(Status.st_size) >= sizeof(Header)) {
+    Data = mmap(nullptr, Status.st_size, PROT_READ, MAP_PRIVATE, File, 0);
+  }
+  close(File);
+  if (Data == MAP_FAILED) {
+    return false;
+  }
+  Mapped = Data;
+  Mapped_Bytes = Status.st_size;
+
+  /**
+   * Check the header against the size of the file, bounding every field
+   * first so the sizes computed from them cannot overflow
+   */
+  const Header *Head = static_cast<const Header*>(Data);
+  bool Valid = std::memcmp(Head->Magic, "AGB1", 4) == 0
+      && Head->Directions > 0 && Head->Directions <= 256
+      && Head->Palette_Size > 0
+      && Head->Palette_Size <= Mapped_Bytes / sizeof(Box16);
+  for (int Axis = 0; Axis < 3; ++Axis) {
+    Valid = Valid && Head->World[Axis] > 0 && Head->World[Axis] <= 0xFFFF;
+  }
+  std::size_t Palette_Bytes = 0;
+  if (Valid) {
+    Palette_Bytes = Head->Palette_Size * sizeof(Box16);
+    Palette_Bytes += (8 - Palette_Bytes % 8) % 8;
+    uint64_t Expected_Index = static_cast<uint64_t>(Head->World[0])
+        * Head->World[1] * Head->World[2] * Head->Directions;
+    Valid = Head->Index_Size == Expected_Index
+        && Expected_Index <= Mapped_Bytes / sizeof(uint32_t)
+        && sizeof(Header) + Palette_Bytes
+            + Head->Index_Size * sizeof(uint32_t) == Mapped_Bytes;
+  }
+  /** Every index has to point into the palette */
+  const char *Bytes = static_cast<const char*>(Data) + sizeof(Header);
+  const uint32_t *Mapped_Index = reinterpret_cast<const uint32_t*>(
+      Bytes + Palette_Bytes);
+  for (uint64_t i = 0; Valid && i < Head->Index_Size; ++i) {
+    Valid = Mapped_Index[i] < Head->Palette_Size;
+  }
+  if (!Valid) {
+    Unmap();
+    return false;
+  }
+  World_Size = {Head->World[0], Head->World[1], Head->World[2]};
+  Directions = static_cast<int>(Head->Directions);
+  Palette_Size = Head->Palette_Size;
+  Palette = reinterpret_cast<const Box16*>(Bytes);
+  Index = Mapped_Index;
+  return true;
+}
+
+/**
+ * @brief Box gives the box of Goals reached optimally by a move
+ * @param coordinates_ has type Vec3i and stores the Node
+ * @param Direction_ has type int and stores the index of the direction
+ * @return box of type Box16
+ */
+const Goal_Bounding::Box16& Goal_Bounding::Box(Vec3i coordinates_,
+                                               int Direction_) const {
+  std::size_t Cell = (static_cast<std::size_t>(coordinates_.z) * World_Size.y
+      + coordinates_.y) * World_Size.x + coordinates_.x;
+  return Palette[Index[Cell * Directions + Direction_]];
+}
+
+/**
+ * @brief Allows checks if the Goal lies in the box of a move
+ * @param coordinates_ has type Vec3i and stores the Node
+ * @param Direction_ has type int and stores the index of the direction
+ * @param Goal_ has type Vec3i and stores the Goal
+ * @return true if the move can start a shortest path to the Goal
+ */
+bool Goal_Bounding::Allows(Vec3i coordinates_, int Direction_,
+                           Vec3i Goal_) const {
+  const Box16& Bounds = Box(coordinates_, Direction_);
+  return Goal_.x >= Bounds.Min[0] && Goal_.x <= Bounds.Max[0]
+      && Goal_.y >= Bounds.Min[1] && Goal_.y <= Bounds.Max[1]
+      && Goal_.z >= Bounds.Min[2] && Goal_.z <= Bounds.Max[2];
+}
+
+/**
+ * @brief Empty checks if a table was built or loaded
+ * @return true if there is no table
+ */
+bool Goal_Bounding::Empty() const {
+  return Palette == nullptr;
+}
+
+/**
+ * @brief Bytes gives the size of the compressed table
+ * @return number of bytes of the palette and indices
+ */
+std::size_t Goal_Bounding::Bytes() const {
+  return Palette_Size * sizeof(Box16) + static_cast<std::size_t>(World_Size.x)
+      * World_Size.y * World_Size.z * Directions * sizeof(uint32_t);
+}
+
+/**
+ * @brief Raw_Bytes gives the size of one box per Node and direction
+ * @return number of bytes
+ */
+std::size_t Goal_Bounding::Raw_Bytes() const {
+  return static_cast<std::size_t>(World_Size.x) * World_Size.y * World_Size.z
+      * Directions * sizeof(Box16);
+}
+
+/**
+ * @brief Unmap releases the file mapped by Load
+ * @return void
+ */
+void Goal_Bounding::Unmap() {
+  if (Mapped != nullptr) {
+    munmap(Mapped, Mapped_Bytes);
+    Mapped = nullptr;
+    Mapped_Bytes = 0;
+  }
+  Palette = nullptr;
+  Index = nullptr;
+  Palette_Size = 0;
+}
+
+/** Destructor for Goal_Bounding Class */
+Goal_Bounding::~Goal_Bounding() {
+  Unmap();
+}
@@ -0,0 +1,158 @@
+/**
+ * @file Grid_Geometry.cpp
+ * @brief This file contains the batched point conversions of Grid_Geometry
+ * class. Points are converted several at a time with AVX or SSE2 and the
+ * remaining points with the scalar constexpr conversions.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* --Includes-- */
+#if defined(__AVX__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+#include "../include/Grid_Geometry.h"
+
+/**
+ * Vec3d and Vec3i arrays are read as flat double and int arrays, which
+ * needs them to be packed without padding.
+ */
+static_assert(sizeof(Vec3d) == 3 * sizeof(double), "Vec3d must be packed");
+static_assert(sizeof(Vec3i) == 3 * sizeof(int), "Vec3i must be packed");
+
+/**
+ * @brief To_Cells converts an array of points to Nodes. Points are treated
+ * as a flat array of doubles whose x,y,z pattern repeats every 4 points for
+ * AVX and every 2 points for SSE2, so the origin and resolution are loaded
+ * once per lane pattern. Dividing rather than multiplying by the inverse
+ * keeps the results equal to To_Cell.
+ * @param Points_ has type Vec3d array and stores points of the World
+ * @param Count_ has type size_t and stores the number of points
+ * @param Cells_ has type Vec3i array and receives the Nodes
+ * @return void
+ */
+void Grid_Geometry::To_Cells(const Vec3d* Points_, std::size_t Count_,
+                             Vec3i* Cells_) const {
+  std::size_t i = 0;
+  const double *In = &Points_->x;
+  int *Out = &Cells_->x;
+#if defined(__AVX__)
+  const __m256d Origin[3] = {
+    _mm256_setr_pd(Boundary.Min.x, Boundary.Min.y, Boundary.Min.z,
+                   Boundary.Min.x),
+    _mm256_setr_pd(Boundary.Min.y, Boundary.Min.z, Boundary.Min.x,
+                   Boundary.Min.y),
+    _mm256_setr_pd(Boundary.Min.z, Boundary.Min.x, Boundary.Min.y,
+                   Boundary.Min.z) };
+  const __m256d Scale[3] = {
+    _mm256_setr_pd(Resolution.x, Resolution.y, Resolution.z, Resolution.x),
+    _mm256_setr_pd(Resolution.y, Resolution.z, Resolution.x, Resolution.y),
+    _mm256_setr_pd(Resolution.z, Resolution.x, Resolution.y, Resolution.z) };
+  for (; i + 4 <= Count_; i += 4, In += 12, Out += 12) {
+    for (int Lane = 0; Lane < 3; ++Lane) {
+      __m256d Value = _mm256_loadu_pd(In + 4 * Lane);
+      Value = _mm256_div_pd(_mm256_sub_pd(Value, Origin[Lane]), Scale[Lane]);
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(Out + 4 * Lane),
+                       _mm256_cvttpd_epi32(Value));
+    }
+  }
+#elif defined(__SSE2__)
+  const __m128d Origin[3] = {
+    _mm_setr_pd(Boundary.Min.x, Boundary.Min.y),
+    _mm_setr_pd(Boundary.Min.z, Boundary.Min.x),
+    _mm_setr_pd(Boundary.Min.y, Boundary.Min.z) };
+  const __m128d Scale[3] = {
+    _mm_setr_pd(Resolution.x, Resolution.y),
+    _mm_setr_pd(Resolution.z, Resolution.x),
+    _mm_setr_pd(Resolution.y, Resolution.z) };
+  for (; i + 2 <= Count_; i += 2, In += 6, Out += 6) {
+    for (int Lane = 0; Lane < 3; ++Lane) {
+      __m128d Value = _mm_loadu_pd(In + 2 * Lane);
+      Value = _mm_div_pd(_mm_sub_pd(Value, Origin[Lane]), Scale[Lane]);
+      _mm_storel_epi64(reinterpret_cast<__m128i*>(Out + 2 * Lane),
+                       _mm_cvttpd_epi32(Value));
+    }
+  }
+#endif
+  for (; i < Count_; ++i) {
+    Cells_[i] = To_Cell(Points_[i]);
+  }
+}
+
+/**
+ * @brief To_Points converts an array of Nodes to points using the same lane
+ * patterns as To_Cells
+ * @param Cells_ has type Vec3i array and stores Nodes
+ * @param Count_ has type size_t and stores the number of Nodes
+ * @param Points_ has type Vec3d array and receives the points of the World
+ * @return void
+ */
+void Grid_Geometry::To_Points(const Vec3i* Cells_, std::size_t Count_,
+                              Vec3d* Points_) const {
+  std::size_t i = 0;
+  const int *In = &Cells_->x;
+  double *Out = &Points_->x;
+#if defined(__AVX__)
+  const __m256d Origin[3] = {
+    _mm256_setr_pd(Boundary.Min.x, Boundary.Min.y, Boundary.Min.z,
+                   Boundary.Min.x),
+    _mm256_setr_pd(Boundary.Min.y, Boundary.Min.z, Boundary.Min.x,
+                   Boundary.Min.y),
+    _mm256_setr_pd(Boundary.Min.z, Boundary.Min.x, Boundary.Min.y,
+                   Boundary.Min.z) };
+  const __m256d Scale[3] = {
+    _mm256_setr_pd(Resolution.x, Resolution.y, Resolution.z, Resolution.x),
+    _mm256_setr_pd(Resolution.y, Resolution.z, Resolution.x, Resolution.y),
+    _mm256_setr_pd(Resolution.z, Resolution.x, Resolution.y, Resolution.z) };
+  for (; i + 4 <= Count_; i += 4, In += 12, Out += 12) {
+    for (int Lane = 0; Lane < 3; ++Lane) {
+      __m256d Value = _mm256_cvtepi32_pd(_mm_loadu_si128(
+          reinterpret_cast<const __m128i*>(In + 4 * Lane)));
+      _mm256_storeu_pd(Out + 4 * Lane, _mm256_add_pd(
+          Origin[Lane], _mm256_mul_pd(Value, Scale[Lane])));
+    }
+  }
+#elif defined(__SSE2__)
+  const __m128d Origin[3] = {
+    _mm_setr_pd(Boundary.Min.x, Boundary.Min.y),
+    _mm_setr_pd(Boundary.Min.z, Boundary.Min.x),
+    _mm_setr_pd(Boundary.Min.y, Boundary.Min.z) };
+  const __m128d Scale[3] = {
+    _mm_setr_pd(Resolution.x, Resolution.y),
+    _mm_setr_pd(Resolution.z, Resolution.x),
+    _mm_setr_pd(Resolution.y, Resolution.z) };
+  for (; i + 2 <= Count_; i += 2, In += 6, Out += 6) {
+    for (int Lane = 0; Lane < 3; ++Lane) {
+      __m128d Value = _mm_cvtepi32_pd(_mm_loadl_epi64(
+          reinterpret_cast<const __m128i*>(In + 2 * Lane)));
+      _mm_storeu_pd(Out + 2 * Lane, _mm_add_pd(
+          Origin[Lane], _mm_mul_pd(Value, Scale[Lane])));
+    }
+  }
+#endif
+  for (; i < Count_; ++i) {
+    Points_[i] = To_Point(Cells_[i]);
+  }
+}
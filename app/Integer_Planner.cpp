@@ -0,0 +1,269 @@
+/**
+ * @file Integer_Planner.cpp
+ * @brief This file contains the code for Integer_Planner class and its
+ * Bucket_Queue.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* --Includes-- */
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+#include <vector>
+#include "../include/Integer_Planner.h"
+
+namespace {
+
+/**
+ * @brief Lower_Priority orders the heap of a bucket, the Entry with higher
+ * G and then lower Cell is on top
+ */
+struct Lower_Priority {
+  bool operator()(const Bucket_Queue::Entry& left_,
+                  const Bucket_Queue::Entry& right_) const {
+    if (left_.G != right_.G) {
+      return left_.G < right_.G;
+    }
+    return left_.Cell > right_.Cell;
+  }
+};
+
+}  // namespace
+
+/**
+ * @brief Constructor for class Bucket_Queue
+ * @param Max_Spread_ of type int stores the largest difference between an
+ * F value and the least F value in the queue
+ */
+Bucket_Queue::Bucket_Queue(int Max_Spread_)
+    : Least_F(0),
+      Mask(1),
+      Count(0) {
+  while (Mask <= static_cast<std::size_t>(std::max(0, Max_Spread_))) {
+    Mask <<= 1;
+  }
+  Buckets.resize(Mask);
+  --Mask;
+}
+
+/**
+ * @brief Push adds an Entry to the bucket of its F value
+ * @param F_ of type int stores the F value, within the spread of the least
+ * F value in the queue
+ * @param Entry_ of type Entry stores the G value and Node
+ * @return void
+ */
+void Bucket_Queue::Push(int F_, Entry Entry_) {
+  if (Count == 0 || F_ < Least_F) {
+    Least_F = F_;
+  }
+  std::vector<Entry>& Bucket = Buckets[static_cast<std::size_t>(F_) & Mask];
+  Bucket.push_back(Entry_);
+  std::push_heap(Bucket.begin(), Bucket.end(), Lower_Priority());
+  ++Count;
+}
+
+/**
+ * @brief Pop removes the Entry with least F value and highest G value
+ * @param Entry_ is set to the removed Entry
+ * @return true if an Entry was removed
+ */
+bool Bucket_Queue::Pop(Entry *Entry_) {
+  if (Count == 0) {
+    return false;
+  }
+  while (Buckets[static_cast<std::size_t>(Least_F) & Mask].empty()) {
+    ++Least_F;
+  }
+  std::vector<Entry>& Bucket = Buckets[static_cast<std::size_t>(Least_F)
+      & Mask];
+  std::pop_heap(Bucket.begin(), Bucket.end(), Lower_Priority());
+  *Entry_ = Bucket.back();
+  Bucket.pop_back();
+  --Count;
+  return true;
+}
+
+/**
+ * @brief Empty checks if the queue holds no Entry
+ * @return true if empty
+ */
+bool Bucket_Queue::Empty() const {
+  return Count == 0;
+}
+
+/**
+ * @brief Clear removes every Entry and keeps the memory of the buckets
+ * @return void
+ */
+void Bucket_Queue::Clear() {
+  for (auto& bucket : Buckets) {
+    bucket.clear();
+  }
+  Count = 0;
+  Least_F = 0;
+}
+
+/**
+ * @brief For_Each visits every Entry of the queue, stale ones included
+ * @param Function_ is called with each Entry
+ * @return void
+ */
+void Bucket_Queue::For_Each(
+    const std::function<void(const Entry&)>& Function_) const {
+  for (const auto& bucket : Buckets) {
+    for (const Entry& entry : bucket) {
+      Function_(entry);
+    }
+  }
+}
+
+/** Destructor for Bucket_Queue Class */
+Bucket_Queue::~Bucket_Queue() {
+}
+
+/**
+ * @brief Constructor for class Integer_Planner. The F value of a successor
+ * exceeds the F value of its parent by at most twice the largest step cost
+ * with a consistent heuristic, which bounds the spread of the queue.
+ * @param Plan_ is the Planner whose World, Obstacles and Directions are used
+ */
+Integer_Planner::Integer_Planner(const Planner& Plan_)
+    : direction(Plan_.direction),
+      Map(Plan_.World_Size),
+      Expanded(0),
+      Cost(-1),
+      Progress_Interval(256),
+      Cancelled(false),
+      Open(0) {
+  Map.Add_Obstacles(Plan_);
+  int Max_Step = 0;
+  for (const Vec3i& move : direction) {
+    Step_Costs.push_back(Planner::Step_Cost(move));
+    Max_Step = std::max(Max_Step, Step_Costs.back());
+  }
+  Open = Bucket_Queue(2 * Max_Step);
+}
+
+/**
+ * @brief Heuristic gives the cost of the cheapest path between two Nodes
+ * without Obstacles, using as many 3D and then planar diagonals as possible
+ * @param Now_ has type Vec3i struct
+ * @param Goal_ has type Vec3i struct
+ * @return integer Octile distance
+ */
+int Integer_Planner::Heuristic(Vec3i Now_, Vec3i Goal_) {
+  int Delta[3] = {std::abs(Now_.x - Goal_.x), std::abs(Now_.y - Goal_.y),
+    std::abs(Now_.z - Goal_.z)};
+  std::sort(Delta, Delta + 3);
+  return 173 * Delta[0] + 141 * (Delta[1] - Delta[0])
+      + 100 * (Delta[2] - Delta[1]);
+}
+
+/**
+ * @brief findPath Finds the path from Start to Goal Point. Parents change
+ * only on a strictly cheaper path and the queue breaks every tie, so the
+ * search never depends on memory addresses or floating point rounding.
+ * @param Start_ of type Vec3i struct which stores Start point coordinates
+ * @param Goal_ of type Vec3i struct which store Goal point coordinates
+ * @return vector of Vec3i type which contains Path from goal to start
+ */
+std::vector<Vec3i> Integer_Planner::findPath(Vec3i Start_, Vec3i Goal_) {
+  std::vector<Vec3i> path;
+  Expanded = 0;
+  Cost = -1;
+  Cancelled = false;
+  G.assign(Map.Size(), std::numeric_limits<int>::max());
+  Parent.assign(Map.Size(), 0);
+  Closed.assign(Map.Size(), 0);
+  Open.Clear();
+  if (Map.Is_Occupied(Start_) || Map.Is_Occupied(Goal_)) {
+    return path;
+  }
+  std::size_t Start_Cell = Map.Index(Start_), Goal_Cell = Map.Index(Goal_);
+  G[Start_Cell] = 0;
+  Parent[Start_Cell] = Start_Cell;
+  Open.Push(Heuristic(Start_, Goal_), {0, Start_Cell});
+  Bucket_Queue::Entry current;
+  while (Open.Pop(&current)) {
+    if (Closed[current.Cell] != 0 || current.G != G[current.Cell]) {
+      continue;  ///< Stale Entry, the Node was reached cheaper since
+    }
+    Closed[current.Cell] = 1;
+    if (current.Cell == Goal_Cell) {
+      Cost = current.G;
+      break;
+    }
+    ++Expanded;
+    Vec3i coordinates = Map.Coordinates(current.Cell);
+    for (std::size_t i = 0; i < direction.size(); ++i) {
+      Vec3i newCoordinates = {coordinates.x + direction[i].x,
+        coordinates.y + direction[i].y, coordinates.z + direction[i].z};
+      if (Map.Is_Occupied(newCoordinates)) {
+        continue;
+      }
+      std::size_t Cell = Map.Index(newCoordinates);
+      int Total_Cost = current.G + Step_Costs[i];
+      if (Closed[Cell] == 0 && Total_Cost < G[Cell]) {
+        G[Cell] = Total_Cost;
+        Parent[Cell] = current.Cell;
+        Open.Push(Total_Cost + Heuristic(newCoordinates, Goal_),
+                  {Total_Cost, Cell});
+      }
+    }
+    /** Report only between expansions, when every Open Node is queued */
+    if (Progress && Progress_Interval > 0 && Expanded % Progress_Interval == 0
+        && !Progress()) {
+      Cancelled = true;
+      break;
+    }
+  }
+
+  /** Store Path from Goal to Start in path vector */
+  if (Cost >= 0) {
+    for (std::size_t Cell = Goal_Cell; ; Cell = Parent[Cell]) {
+      path.push_back(Map.Coordinates(Cell));
+      if (Cell == Start_Cell) {
+        break;
+      }
+    }
+  }
+  return path;
+}
+
+/**
+ * @brief Is_Open checks if an Entry of the Open List still holds the best
+ * known G value of a Node which is not expanded yet
+ * @param Entry_ of type Entry
+ * @return true if the Entry is not stale
+ */
+bool Integer_Planner::Is_Open(const Bucket_Queue::Entry& Entry_) const {
+  return Closed[Entry_.Cell] == 0 && G[Entry_.Cell] == Entry_.G;
+}
+
+/** Destructor for Integer_Planner Class */
+Integer_Planner::~Integer_Planner() {
+}
@@ -0,0 +1,284 @@
+/**
+ * @file Multi_Resolution_Planner.cpp
+ * @brief This file contains the code for Multi_Resolution_Planner class
+ * which builds an occupancy pyramid by max pooling and plans coarse to fine.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* --Includes-- */
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <vector>
+#include "../include/Multi_Resolution_Planner.h"
+
+namespace {
+
+/**
+ * @brief Entry of type Struct is an element of the Open List
+ */
+struct Entry {
+  int F, G;  ///< F and G values of the Node
+  std::size_t Cell;  ///< Index of the Node in the level
+};
+
+/**
+ * @brief Entry_Order orders the Open List by least F value, ties prefer the
+ * higher G value
+ */
+struct Entry_Order {
+  bool operator()(const Entry& left_, const Entry& right_) const {
+    if (left_.F != right_.F) {
+      return left_.F > right_.F;
+    }
+    return left_.G < right_.G;
+  }
+};
+
+/**
+ * @brief Scaled multiplies a Node by the size of a Node of its level
+ * @param coordinates_ has type Vec3i and stores the Node
+ * @param Scale_ has type Vec3i and stores the size of a Node
+ * @return Vec3i in full resolution Nodes
+ */
+Vec3i Scaled(Vec3i coordinates_, Vec3i Scale_) {
+  return {coordinates_.x * Scale_.x, coordinates_.y * Scale_.y,
+    coordinates_.z * Scale_.z};
+}
+
+}  // namespace
+
+/**
+ * @brief Constructor for class Multi_Resolution_Planner. Each level halves
+ * the axes whose Nodes are shortest in World units, x and y together, and
+ * marks a Node as an Obstacle if any Node it covers is one, so a coarse
+ * Obstacle free path never hides a full resolution Obstacle.
+ * @param Plan_ is the Planner whose World, Obstacles and Directions are used
+ * @param Levels_ of type int stores the number of coarse levels, 0 builds
+ * them until every axis is a single Node
+ * @param xy_res_ of type double stores the size of a Node along x and y
+ * @param z_res_ of type double stores the size of a Node along z
+ */
+Multi_Resolution_Planner::Multi_Resolution_Planner(const Planner& Plan_,
+                                                   int Levels_,
+                                                   double xy_res_,
+                                                   double z_res_)
+    : direction(Plan_.direction),
+      Coarse_Level(0),
+      Corridor_Radius(1),
+      Used_Level(0),
+      Expanded(0) {
+  Levels.emplace_back(Plan_.World_Size);
+  Levels[0].Add_Obstacles(Plan_);
+  Scale.push_back({1, 1, 1});
+  while (Levels_ <= 0 || static_cast<int>(Levels.size()) <= Levels_) {
+    Vec3i Fine_Size = Levels.back().World_Size;
+    if (Fine_Size.x <= 1 && Fine_Size.y <= 1 && Fine_Size.z <= 1) {
+      break;
+    }
+    /** Coarsen the shorter sides, or the only ones longer than one Node */
+    double Side_XY = Scale.back().x * xy_res_;
+    double Side_Z = Scale.back().z * z_res_;
+    bool Halve_XY = Side_XY <= Side_Z || Fine_Size.z <= 1;
+    bool Halve_Z = Side_Z <= Side_XY || (Fine_Size.x <= 1 && Fine_Size.y <= 1);
+    Vec3i Factor = {Halve_XY && Fine_Size.x > 1 ? 2 : 1,
+      Halve_XY && Fine_Size.y > 1 ? 2 : 1, Halve_Z && Fine_Size.z > 1 ? 2 : 1};
+    Occupancy_Map Coarse({(Fine_Size.x + Factor.x - 1) / Factor.x,
+      (Fine_Size.y + Factor.y - 1) / Factor.y,
+      (Fine_Size.z + Factor.z - 1) / Factor.z});
+    const Occupancy_Map& Fine = Levels.back();
+    for (std::size_t i = 0; i < Fine.Size(); ++i) {
+      if (Fine.Cells[i] != 0) {
+        Vec3i coordinates = Fine.Coordinates(i);
+        Coarse.Set({coordinates.x / Factor.x, coordinates.y / Factor.y,
+          coordinates.z / Factor.z});
+      }
+    }
+    Vec3i Fine_Scale = Scale.back();
+    Scale.push_back({Fine_Scale.x * Factor.x, Fine_Scale.y * Factor.y,
+      Fine_Scale.z * Factor.z});
+    Levels.push_back(Coarse);
+  }
+  Coarse_Level = std::min(2, static_cast<int>(Levels.size()) - 1);
+}
+
+/**
+ * @brief findPath Finds the path from Start to Goal Point coarse to fine
+ * @param Start_ of type Vec3i struct which stores Start point coordinates
+ * @param Goal_ of type Vec3i struct which store Goal point coordinates
+ * @return vector of Vec3i type which contains Path from goal to start
+ */
+std::vector<Vec3i> Multi_Resolution_Planner::findPath(Vec3i Start_,
+                                                      Vec3i Goal_) {
+  Expanded = 0;
+  Used_Level = 0;
+  const Occupancy_Map& Fine = Levels[0];
+  int First_Level = std::min(Coarse_Level,
+                             static_cast<int>(Levels.size()) - 1);
+  for (int Level = First_Level; Level > 0; --Level) {
+    std::vector<Vec3i> Coarse_Path = Search(Level, To_Level(Level, Start_),
+                                            To_Level(Level, Goal_), nullptr);
+    if (Coarse_Path.empty()) {
+      continue;  ///< Pooling closed every passage, try a finer level
+    }
+    /** Mark the full resolution Nodes of the dilated coarse path */
+    std::vector<uint8_t> Corridor(Fine.Size(), 0);
+    Vec3i Size = Scale[Level];
+    for (const Vec3i& coordinates : Coarse_Path) {
+      Vec3i Low = Scaled({coordinates.x - Corridor_Radius,
+        coordinates.y - Corridor_Radius, coordinates.z - Corridor_Radius},
+        Size);
+      Vec3i High = Scaled({coordinates.x + Corridor_Radius + 1,
+        coordinates.y + Corridor_Radius + 1,
+        coordinates.z + Corridor_Radius + 1}, Size);
+      for (int z = std::max(0, Low.z);
+          z < std::min(High.z, Fine.World_Size.z); ++z) {
+        for (int y = std::max(0, Low.y);
+            y < std::min(High.y, Fine.World_Size.y); ++y) {
+          for (int x = std::max(0, Low.x);
+              x < std::min(High.x, Fine.World_Size.x); ++x) {
+            Corridor[Fine.Index({x, y, z})] = 1;
+          }
+        }
+      }
+    }
+    std::vector<Vec3i> path = Search(0, Start_, Goal_, &Corridor);
+    if (!path.empty()) {
+      Used_Level = Level;
+      return path;
+    }
+  }
+  return Search(0, Start_, Goal_, nullptr);  ///< Full resolution fallback
+}
+
+/**
+ * @brief Search runs A* with the Octile heuristic on one level. Move costs
+ * are measured in full resolution Nodes so every level uses the costs of
+ * Planner::findPath.
+ * @param Level_ of type int stores the level to search
+ * @param Start_ of type Vec3i struct stores the Start Node of the level
+ * @param Goal_ of type Vec3i struct stores the Goal Node of the level
+ * @param Corridor_ marks the full resolution Nodes the path may use, or is
+ * null to use every Node
+ * @return vector of Vec3i type with the Nodes of the level from goal to
+ * start, empty if no path exists
+ */
+std::vector<Vec3i> Multi_Resolution_Planner::Search(
+    int Level_, Vec3i Start_, Vec3i Goal_,
+    const std::vector<uint8_t> *Corridor_) {
+  const Occupancy_Map& Map = Levels[Level_];
+  Vec3i Size = Scale[Level_];
+  auto Passable = [&](Vec3i coordinates_) {
+    if (!Map.Inside(coordinates_)) {
+      return false;
+    }
+    std::size_t Cell = Map.Index(coordinates_);
+    if (Corridor_ != nullptr && (*Corridor_)[Cell] == 0) {
+      return false;
+    }
+    return Map.Cells[Cell] == 0
+        || (Level_ > 0 && (coordinates_ == Start_ || coordinates_ == Goal_));
+  };
+  std::vector<Vec3i> path;
+  if (!Passable(Start_) || !Passable(Goal_)) {
+    return path;
+  }
+  std::vector<int> Step_Costs;
+  for (const Vec3i& move : direction) {
+    Step_Costs.push_back(static_cast<int>(
+        Planner::Octile({0, 0, 0}, Scaled(move, Size))));
+  }
+  Vec3i Scaled_Goal = Scaled(Goal_, Size);
+  auto Heuristic = [&](Vec3i coordinates_) {
+    return static_cast<int>(Planner::Octile(Scaled(coordinates_, Size),
+                                            Scaled_Goal));
+  };
+
+  std::vector<int> G(Map.Size(), std::numeric_limits<int>::max());
+  std::vector<std::size_t> Parent(Map.Size());
+  std::vector<uint8_t> Closed(Map.Size(), 0);
+  std::priority_queue<Entry, std::vector<Entry>, Entry_Order> Open;
+  std::size_t Start_Cell = Map.Index(Start_), Goal_Cell = Map.Index(Goal_);
+  G[Start_Cell] = 0;
+  Parent[Start_Cell] = Start_Cell;
+  Open.push({Heuristic(Start_), 0, Start_Cell});
+  while (!Open.empty()) {
+    Entry current = Open.top();
+    Open.pop();
+    if (Closed[current.Cell] != 0) {
+      continue;  ///< Stale Entry, the Node was expanded already
+    }
+    Closed[current.Cell] = 1;
+    if (current.Cell == Goal_Cell) {
+      break;
+    }
+    ++Expanded;
+    Vec3i coordinates = Map.Coordinates(current.Cell);
+    for (std::size_t i = 0; i < direction.size(); ++i) {
+      Vec3i newCoordinates = {coordinates.x + direction[i].x,
+        coordinates.y + direction[i].y, coordinates.z + direction[i].z};
+      if (!Passable(newCoordinates)) {
+        continue;
+      }
+      std::size_t Cell = Map.Index(newCoordinates);
+      int Total_Cost = current.G + Step_Costs[i];
+      if (Closed[Cell] == 0 && Total_Cost < G[Cell]) {
+        G[Cell] = Total_Cost;
+        Parent[Cell] = current.Cell;
+        Open.push({Total_Cost + Heuristic(newCoordinates), Total_Cost, Cell});
+      }
+    }
+  }
+
+  /** Store Path from Goal to Start in path vector */
+  if (Closed[Goal_Cell] != 0) {
+    for (std::size_t Cell = Goal_Cell; ; Cell = Parent[Cell]) {
+      path.push_back(Map.Coordinates(Cell));
+      if (Cell == Start_Cell) {
+        break;
+      }
+    }
+  }
+  return path;
+}
+
+/**
+ * @brief To_Level gives the Node of a level containing a full resolution
+ * Node
+ * @param Level_ of type int stores the level
+ * @param coordinates_ of type Vec3i stores the full resolution Node
+ * @return Vec3i Node of the level
+ */
+Vec3i Multi_Resolution_Planner::To_Level(int Level_,
+                                         Vec3i coordinates_) const {
+  return {coordinates_.x / Scale[Level_].x, coordinates_.y / Scale[Level_].y,
+    coordinates_.z / Scale[Level_].z};
+}
+
+/** Destructor for Multi_Resolution_Planner Class */
+Multi_Resolution_Planner::~Multi_Resolution_Planner() {
+}
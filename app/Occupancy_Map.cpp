@@ -0,0 +1,171 @@
+/**
+ * @file Occupancy_Map.cpp
+ * @brief This file contains the code for Occupancy_Map class which stores
+ * the Obstacle Nodes of the Discretized Workspace as a dense grid.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* --Includes-- */
+#include <vector>
+#include "../include/Occupancy_Map.h"
+#include "../include/Snapshot_Map.h"
+
+/**
+ * @brief Constructor for Occupancy_Map Class
+ * @param World_Size_ of type Vec3i struct stores the World Dimensions
+ * @param Cells has type uint8_t vector and is initialized to all Free Nodes
+ */
+Occupancy_Map::Occupancy_Map(Vec3i World_Size_)
+    : World_Size(World_Size_),
+      Cells(static_cast<std::size_t>(World_Size_.x) * World_Size_.y
+            * World_Size_.z, 0) {
+}
+
+/**
+ * @brief Inside checks if the Node lies inside the World
+ * @param coordinates_ has a type Vec3i and stores the coordinates
+ * @return true if the Node lies inside the World else false
+ */
+bool Occupancy_Map::Inside(Vec3i coordinates_) const {
+  return coordinates_.x >= 0 && coordinates_.x < World_Size.x
+      && coordinates_.y >= 0 && coordinates_.y < World_Size.y
+      && coordinates_.z >= 0 && coordinates_.z < World_Size.z;
+}
+
+/**
+ * @brief Is_Occupied checks if the Node is an Obstacle
+ * @param coordinates_ has a type Vec3i and stores the coordinates
+ * @return true if the Node is an Obstacle or lies outside the World
+ */
+bool Occupancy_Map::Is_Occupied(Vec3i coordinates_) const {
+  return !Inside(coordinates_) || Cells[Index(coordinates_)] != 0;
+}
+
+/**
+ * @brief Set marks the Node as an Obstacle. Nodes outside the World are
+ * ignored.
+ * @param coordinates_ has a type Vec3i and stores the coordinates
+ * @return void
+ */
+void Occupancy_Map::Set(Vec3i coordinates_) {
+  if (Inside(coordinates_)) {
+    Cells[Index(coordinates_)] = 1;
+  }
+}
+
+/**
+ * @brief Clear marks the Node as Free. Nodes outside the World are ignored.
+ * @param coordinates_ has a type Vec3i and stores the coordinates
+ * @return void
+ */
+void Occupancy_Map::Clear(Vec3i coordinates_) {
+  if (Inside(coordinates_)) {
+    Cells[Index(coordinates_)] = 0;
+  }
+}
+
+/**
+ * @brief Add_Walls marks all Nodes of a walls list as Obstacles
+ * @param walls_ has type Vec3i vector and stores the Obstacle Nodes
+ * @return void
+ */
+void Occupancy_Map::Add_Walls(const std::vector<Vec3i>& walls_) {
+  for (const Vec3i& wall : walls_) {
+    Set(wall);
+  }
+}
+
+/**
+ * @brief Add_Obstacles marks all Obstacles of a Planner. An occupancy map of
+ * the same World Size is merged cell by cell, any other one Node by Node
+ * with the test of Planner::Detect_Collision, so Nodes outside it count as
+ * Obstacles. A Snapshot_Map is copied from one Snapshot read now.
+ * @param Plan_ is the Planner whose walls, snapshots and occupancy are copied
+ * @return void
+ */
+void Occupancy_Map::Add_Obstacles(const Planner& Plan_) {
+  Add_Walls(Plan_.walls);
+  if (Plan_.snapshots) {
+    Snapshot_Map::Snapshot View = Plan_.snapshots->Read();
+    for (std::size_t i = 0; i < Cells.size(); ++i) {
+      if (View.Is_Occupied(Coordinates(i))) {
+        Cells[i] = 1;
+      }
+    }
+  }
+  if (!Plan_.occupancy) {
+    return;
+  }
+  const Occupancy_Map& Other = *Plan_.occupancy;
+  if (Other.World_Size == World_Size) {
+    for (std::size_t i = 0; i < Cells.size(); ++i) {
+      Cells[i] |= Other.Cells[i];
+    }
+    return;
+  }
+  for (std::size_t i = 0; i < Cells.size(); ++i) {
+    if (Other.Is_Occupied(Coordinates(i))) {
+      Cells[i] = 1;
+    }
+  }
+}
+
+/**
+ * @brief Index gives the position of a Node inside Cells, x varies fastest
+ * @param coordinates_ has a type Vec3i and stores the coordinates
+ * @return position of the Node of type size_t
+ */
+std::size_t Occupancy_Map::Index(Vec3i coordinates_) const {
+  return (static_cast<std::size_t>(coordinates_.z) * World_Size.y
+      + coordinates_.y) * World_Size.x + coordinates_.x;
+}
+
+/**
+ * @brief Coordinates gives the Node stored at a position of Cells
+ * @param Index_ has type size_t and stores the position inside Cells
+ * @return Vec3i type coordinates of the Node
+ */
+Vec3i Occupancy_Map::Coordinates(std::size_t Index_) const {
+  int x = static_cast<int>(Index_ % World_Size.x);
+  Index_ /= World_Size.x;
+  int y = static_cast<int>(Index_ % World_Size.y);
+  int z = static_cast<int>(Index_ / World_Size.y);
+  return {x, y, z};
+}
+
+/**
+ * @brief Size gives the number of Nodes in the World
+ * @return number of Nodes of type size_t
+ */
+std::size_t Occupancy_Map::Size() const {
+  return Cells.size();
+}
+
+/**
+ * @brief Destructor of Occupancy_Map Class
+ */
+Occupancy_Map::~Occupancy_Map() {
+}
@@ -0,0 +1,349 @@
+/**
+ * @file Parallel_Planner.cpp
+ * @brief This file contains the code for Parallel_Planner class which plans
+ * a single Start to Goal query on many threads using Hash Distributed A*.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* --Includes-- */
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <queue>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "../include/Parallel_Planner.h"
+
+namespace {
+
+/** No_Parent marks the Start Node which has no Parent */
+const std::size_t No_Parent = std::numeric_limits<std::size_t>::max();
+
+/**
+ * @brief Message of type Struct carries a generated Node to its owner thread.
+ * Messages form singly linked lists so a whole batch is sent with one CAS.
+ */
+struct Message {
+  std::size_t Cell, Parent;  ///< Node and Parent positions in the Map
+  double G;  ///< Cost-to-Start value through Parent
+  Message *Next;  ///< Next Message in the batch
+};
+
+/**
+ * @brief Entry of type Struct is an element of the Open List of a thread
+ */
+struct Entry {
+  double F, G;  ///< F and G values when the Entry was pushed
+  std::size_t Cell;  ///< Node position in the Map
+};
+
+/**
+ * @brief Entry_Order orders the Open List by least F value. Ties prefer the
+ * higher G value, which is closer to the Goal, then the lower position so the
+ * order never depends on memory addresses.
+ */
+struct Entry_Order {
+  bool operator()(const Entry& left_, const Entry& right_) const {
+    if (left_.F != right_.F) {
+      return left_.F > right_.F;
+    }
+    if (left_.G != right_.G) {
+      return left_.G < right_.G;
+    }
+    return left_.Cell > right_.Cell;
+  }
+};
+
+/**
+ * @brief Record of type Struct stores the best known G value and Parent of
+ * a Node owned by a thread. It is used for duplicate detection and to
+ * rebuild the path.
+ */
+struct Record {
+  double G;
+  std::size_t Parent;
+};
+
+}  // namespace
+
+/**
+ * @brief Worker of type Struct holds the Open List, owned Nodes and incoming
+ * Message queue of one thread.
+ */
+struct Parallel_Planner::Worker {
+  /** Inbox is a lock-free multiple producer single consumer stack */
+  std::atomic<Message*> Inbox;
+  /** Open List of the thread */
+  std::priority_queue<Entry, std::vector<Entry>, Entry_Order> Open;
+  /** Records of the Nodes owned by the thread */
+  std::unordered_map<std::size_t, Record> Records;
+  /** First and last Message of the batch waiting for each thread */
+  std::vector<Message*> Batch_Head, Batch_Tail;
+  /** Heuristic Function, copied so threads never share it */
+  std::function<double(Vec3i, Vec3i)> heuristic;
+  /** Nodes expanded and Messages sent by the thread */
+  std::size_t Expanded, Sent;
+  Worker() : Inbox(nullptr), Expanded(0), Sent(0) {}
+};
+
+/**
+ * @brief Search of type Struct holds the state of one findPath query which
+ * is shared by all threads.
+ */
+struct Parallel_Planner::Search {
+  const Parallel_Planner *Owner;  ///< Planner with Map and Directions
+  std::vector<std::unique_ptr<Worker>> Workers;  ///< One Worker per thread
+  std::size_t Goal;  ///< Goal Node position in the Map
+  Vec3i Goal_Coordinates;  ///< Goal Node coordinates
+  /**
+   * Work counts the Open List Entries plus the Messages in flight. It is
+   * raised before a Node is handed over and lowered only after its
+   * successors are counted, so it reaches zero only once every thread is
+   * out of work and no Message can arrive anymore.
+   */
+  std::atomic<long> Work;
+  /** Incumbent is the cost of the best path to the Goal found so far */
+  std::atomic<double> Incumbent;
+  std::vector<int> Step_Costs;  ///< Cost of moving along each direction
+
+  /**
+   * @brief Owner_Of hashes a Node position to the thread which owns it
+   * @param Cell_ has type size_t and stores the Node position
+   * @return index of the owner thread
+   */
+  int Owner_Of(std::size_t Cell_) const {
+    uint64_t Hash = static_cast<uint64_t>(Cell_) * 0x9E3779B97F4A7C15ULL;
+    return static_cast<int>((Hash >> 32) % Workers.size());
+  }
+
+  /**
+   * @brief Receive offers a Node to its owner thread
+   * @param Self_ is the owner Worker
+   * @param Cell_ Parent_ G_ describe the offered Node
+   * @return true if the Node was added to the Open List
+   */
+  bool Receive(Worker *Self_, std::size_t Cell_, std::size_t Parent_,
+               double G_) {
+    auto found = Self_->Records.find(Cell_);
+    if (found != Self_->Records.end() && found->second.G <= G_) {
+      return false;  ///< Duplicate which is not cheaper than the known one
+    }
+    Self_->Records[Cell_] = {G_, Parent_};
+    if (Cell_ == Goal) {
+      /** Lower the Incumbent, the Goal itself is never expanded */
+      double Best = Incumbent.load();
+      while (G_ < Best && !Incumbent.compare_exchange_weak(Best, G_)) {
+      }
+      return false;
+    }
+    double F = G_ + Self_->heuristic(Owner->Map.Coordinates(Cell_),
+                                     Goal_Coordinates);
+    if (F >= Incumbent.load()) {
+      return false;  ///< Can not lead to a cheaper path
+    }
+    Self_->Open.push({F, G_, Cell_});
+    return true;
+  }
+};
+
+/**
+ * @brief Constructor for class Parallel_Planner
+ * @param Plan_ is the Planner whose World, Obstacles, Directions and
+ * Heuristic are used
+ */
+Parallel_Planner::Parallel_Planner(const Planner& Plan_)
+    : heuristic(Plan_.heuristic),
+      direction(Plan_.direction),
+      Map(Plan_.World_Size),
+      Expanded(0),
+      Messages(0) {
+  Map.Add_Obstacles(Plan_);
+}
+
+/**
+ * @brief Run_Worker expands the Nodes owned by one thread until the Work
+ * counter of the Search reaches zero
+ * @param Search_ is the shared state of the query
+ * @param Self_ is the index of the thread
+ * @return void
+ */
+void Parallel_Planner::Run_Worker(Search *Search_, int Self_) {
+  Worker *Self = Search_->Workers[Self_].get();
+  const Occupancy_Map& Map = Search_->Owner->Map;
+  const std::vector<Vec3i>& direction = Search_->Owner->direction;
+
+  while (true) {
+    /** Take every Message sent to this thread */
+    Message *Received = Self->Inbox.exchange(nullptr,
+                                             std::memory_order_acquire);
+    while (Received != nullptr) {
+      Message *Next = Received->Next;
+      if (!Search_->Receive(Self, Received->Cell, Received->Parent,
+                            Received->G)) {
+        --Search_->Work;
+      }
+      delete Received;
+      Received = Next;
+    }
+
+    if (Self->Open.empty()) {
+      /** Nothing to expand, stop once no thread has Work left */
+      if (Search_->Work.load() == 0) {
+        break;
+      }
+      std::this_thread::yield();
+      continue;
+    }
+
+    Entry current = Self->Open.top();
+    Self->Open.pop();
+    if (current.G > Self->Records[current.Cell].G
+        || current.F >= Search_->Incumbent.load()) {
+      --Search_->Work;  ///< Stale or pruned Entry
+      continue;
+    }
+    ++Self->Expanded;
+
+    /** From all movable directions, send the neighbors to their owners */
+    Vec3i coordinates = Map.Coordinates(current.Cell);
+    for (std::size_t i = 0; i < direction.size(); ++i) {
+      Vec3i newCoordinates = {coordinates.x + direction[i].x,
+        coordinates.y + direction[i].y, coordinates.z + direction[i].z};
+      if (Map.Is_Occupied(newCoordinates)) {
+        continue;
+      }
+      std::size_t Cell = Map.Index(newCoordinates);
+      double Total_Cost = current.G + Search_->Step_Costs[i];
+      int Owner = Search_->Owner_Of(Cell);
+      if (Owner == Self_) {
+        if (Search_->Receive(Self, Cell, current.Cell, Total_Cost)) {
+          ++Search_->Work;
+        }
+        continue;
+      }
+      ++Search_->Work;
+      ++Self->Sent;
+      Message *Sending = new Message {Cell, current.Cell, Total_Cost,
+        nullptr};
+      if (Self->Batch_Head[Owner] == nullptr) {
+        Self->Batch_Tail[Owner] = Sending;
+      } else {
+        Sending->Next = Self->Batch_Head[Owner];
+      }
+      Self->Batch_Head[Owner] = Sending;
+    }
+
+    /** Push each batch onto the Inbox of its owner with a single CAS */
+    for (std::size_t Owner = 0; Owner < Self->Batch_Head.size(); ++Owner) {
+      Message *Head = Self->Batch_Head[Owner];
+      if (Head == nullptr) {
+        continue;
+      }
+      Message *Tail = Self->Batch_Tail[Owner];
+      std::atomic<Message*>& Inbox = Search_->Workers[Owner]->Inbox;
+      Tail->Next = Inbox.load(std::memory_order_relaxed);
+      while (!Inbox.compare_exchange_weak(Tail->Next, Head,
+                                          std::memory_order_release,
+                                          std::memory_order_relaxed)) {
+      }
+      Self->Batch_Head[Owner] = Self->Batch_Tail[Owner] = nullptr;
+    }
+    --Search_->Work;  ///< The expanded Entry is done
+  }
+}
+
+/**
+ * @brief findPath Finds the path from Start to Goal Point on many threads
+ * @param Start_ of type Vec3i struct which stores Start point coordinates
+ * @param Goal_ of type Vec3i struct which store Goal point coordinates
+ * @param Threads_ of type int stores the number of threads, 0 uses all
+ * hardware threads
+ * @return vector of Vec3i type which contains Path from goal to start, empty
+ * if no path exists
+ */
+std::vector<Vec3i> Parallel_Planner::findPath(Vec3i Start_, Vec3i Goal_,
+                                              int Threads_) {
+  std::vector<Vec3i> path;
+  Expanded = Messages = 0;
+  if (!Map.Inside(Start_) || !Map.Inside(Goal_)) {
+    return path;
+  }
+  if (Threads_ <= 0) {
+    Threads_ = std::max(1, static_cast<int>(
+        std::thread::hardware_concurrency()));
+  }
+
+  Search Query;
+  Query.Owner = this;
+  Query.Goal = Map.Index(Goal_);
+  Query.Goal_Coordinates = Goal_;
+  Query.Incumbent = std::numeric_limits<double>::infinity();
+  for (const Vec3i& move : direction) {
+    Query.Step_Costs.push_back(Planner::Step_Cost(move));
+  }
+  for (int i = 0; i < Threads_; ++i) {
+    Query.Workers.emplace_back(new Worker());
+    Query.Workers.back()->heuristic = heuristic;
+    Query.Workers.back()->Batch_Head.assign(Threads_, nullptr);
+    Query.Workers.back()->Batch_Tail.assign(Threads_, nullptr);
+  }
+
+  /** Send the Start Node to its owner and run all threads */
+  std::size_t Start = Map.Index(Start_);
+  Query.Work = 1;
+  Query.Workers[Query.Owner_Of(Start)]->Inbox = new Message {Start, No_Parent,
+    0, nullptr};
+  std::vector<std::thread> Threads;
+  for (int i = 1; i < Threads_; ++i) {
+    Threads.emplace_back(&Parallel_Planner::Run_Worker, &Query, i);
+  }
+  Run_Worker(&Query, 0);
+  for (auto& thread : Threads) {
+    thread.join();
+  }
+
+  for (auto& worker : Query.Workers) {
+    Expanded += worker->Expanded;
+    Messages += worker->Sent;
+  }
+  /** Store Path from Goal to Start in path vector */
+  if (Query.Incumbent.load() == std::numeric_limits<double>::infinity()) {
+    return path;
+  }
+  std::size_t Cell = Query.Goal;
+  while (Cell != No_Parent) {
+    path.push_back(Map.Coordinates(Cell));
+    Cell = Query.Workers[Query.Owner_Of(Cell)]->Records.at(Cell).Parent;
+  }
+  return path;  ///< Return Calculated path
+}
+
+/** Destructor for Parallel_Planner Class */
+Parallel_Planner::~Parallel_Planner() {
+}
@@ -0,0 +1,232 @@
+/**
+ * @file Passability_Map.cpp
+ * @brief This file contains the code for Passability_Map class which
+ * precomputes the corner cutting free moves of every Node and keeps them
+ * up to date as Obstacles are added.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* --Includes-- */
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+#include "../include/Passability_Map.h"
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace {
+
+/** Blocked is a Sweeps bit which is never free, for unsupported moves */
+const uint32_t Blocked = 1u << 27;
+
+/**
+ * @brief Neighbor_Bit gives the bit of an offset in a 3x3x3 neighborhood
+ * @param Offset_ has type Vec3i struct with components from -1 to 1
+ * @return bit of type uint32_t
+ */
+uint32_t Neighbor_Bit(Vec3i Offset_) {
+  return 1u << ((Offset_.z + 1) * 9 + (Offset_.y + 1) * 3 + Offset_.x + 1);
+}
+
+}  // namespace
+
+/**
+ * @brief Constructor for class Passability_Map. The z layers of the World
+ * are handed out to the threads one at a time.
+ * @param Plan_ is the Planner whose World, Obstacles and Directions are used
+ * @param Threads_ of type int stores the number of threads, 0 for all
+ */
+Passability_Map::Passability_Map(const Planner& Plan_, int Threads_)
+    : Map(Plan_.World_Size),
+      direction(Plan_.direction) {
+  Map.Add_Obstacles(Plan_);
+  for (std::size_t i = 0; i < direction.size(); ++i) {
+    const Vec3i& move = direction[i];
+    if (i >= 32 || std::abs(move.x) > 1 || std::abs(move.y) > 1
+        || std::abs(move.z) > 1) {
+      Sweeps.push_back(Blocked);
+      continue;
+    }
+    /** Every Node reached by taking a subset of the move's axes */
+    uint32_t Sweep = 0;
+    for (int Axes = 1; Axes < 8; ++Axes) {
+      Sweep |= Neighbor_Bit({ (Axes & 1) ? move.x : 0,
+        (Axes & 2) ? move.y : 0, (Axes & 4) ? move.z : 0 });
+    }
+    Sweeps.push_back(Sweep);
+  }
+  Masks.assign(Map.Size(), 0);
+
+  std::atomic<int> Next_Layer(0);
+  auto Fill = [&]() {
+    for (int Layer = Next_Layer++; Layer < Map.World_Size.z;
+        Layer = Next_Layer++) {
+      std::size_t Cell = Map.Index({ 0, 0, Layer });
+      for (int Counter_Y = 0; Counter_Y < Map.World_Size.y; ++Counter_Y) {
+        for (int Counter_X = 0; Counter_X < Map.World_Size.x; ++Counter_X) {
+          Masks[Cell++] = Compute({ Counter_X, Counter_Y, Layer });
+        }
+      }
+    }
+  };
+  if (Threads_ <= 0) {
+    Threads_ = std::max(1, static_cast<int>(
+        std::thread::hardware_concurrency()));
+  }
+  std::vector<std::thread> Threads;
+  for (int i = 1; i < Threads_; ++i) {
+    Threads.emplace_back(Fill);
+  }
+  Fill();
+  for (auto& thread : Threads) {
+    thread.join();
+  }
+}
+
+/**
+ * @brief Mask gives the passable moves from a Node
+ * @param coordinates_ has a type Vec3i and stores the coordinates
+ * @return mask of type uint32_t, bit i set if direction[i] is passable
+ */
+uint32_t Passability_Map::Mask(Vec3i coordinates_) const {
+  return Map.Inside(coordinates_) ? Masks[Map.Index(coordinates_)] : 0;
+}
+
+/**
+ * @brief Lowest_Move finds the first move of a mask, with the bit scan
+ * instruction where the compiler exposes it
+ * @param Moves_ of type uint32_t is a mask with at least one bit set
+ * @return index of the lowest bit set of type int
+ */
+int Passability_Map::Lowest_Move(uint32_t Moves_) {
+#if defined(__GNUC__)
+  return __builtin_ctz(Moves_);
+#elif defined(_MSC_VER)
+  unsigned long Index;
+  _BitScanForward(&Index, Moves_);
+  return static_cast<int>(Index);
+#else
+  int Index = 0;
+  for (; (Moves_ & 1u) == 0; Moves_ >>= 1) {
+    ++Index;
+  }
+  return Index;
+#endif
+}
+
+/**
+ * @brief Allows checks one move from a Node
+ * @param coordinates_ has a type Vec3i and stores the coordinates
+ * @param Direction_ of type int is the index of the move in direction
+ * @return true if the move is passable
+ */
+bool Passability_Map::Allows(Vec3i coordinates_, int Direction_) const {
+  return Direction_ >= 0 && Direction_ < 32
+      && (Mask(coordinates_) >> Direction_ & 1u) != 0;
+}
+
+/**
+ * @brief Set marks the Node as an Obstacle. Nodes outside the World are
+ * ignored.
+ * @param coordinates_ has a type Vec3i and stores the coordinates
+ * @return void
+ */
+void Passability_Map::Set(Vec3i coordinates_) {
+  if (Map.Inside(coordinates_)) {
+    Map.Set(coordinates_);
+    Update(coordinates_);
+  }
+}
+
+/**
+ * @brief Clear marks the Node as Free. Nodes outside the World are ignored.
+ * @param coordinates_ has a type Vec3i and stores the coordinates
+ * @return void
+ */
+void Passability_Map::Clear(Vec3i coordinates_) {
+  if (Map.Inside(coordinates_)) {
+    Map.Clear(coordinates_);
+    Update(coordinates_);
+  }
+}
+
+/**
+ * @brief Compute checks the Sweep of every direction against the free
+ * Nodes around a Node, one lookup per neighbor instead of one per swept
+ * Node of every move
+ * @param coordinates_ has a type Vec3i and stores the coordinates
+ * @return mask of type uint32_t
+ */
+uint32_t Passability_Map::Compute(Vec3i coordinates_) const {
+  if (Map.Is_Occupied(coordinates_)) {
+    return 0;
+  }
+  uint32_t Free = 0;
+  for (int Counter_Z = -1; Counter_Z <= 1; ++Counter_Z) {
+    for (int Counter_Y = -1; Counter_Y <= 1; ++Counter_Y) {
+      for (int Counter_X = -1; Counter_X <= 1; ++Counter_X) {
+        if (!Map.Is_Occupied({ coordinates_.x + Counter_X,
+            coordinates_.y + Counter_Y, coordinates_.z + Counter_Z })) {
+          Free |= Neighbor_Bit({ Counter_X, Counter_Y, Counter_Z });
+        }
+      }
+    }
+  }
+  uint32_t Result = 0;
+  for (std::size_t i = 0; i < Sweeps.size(); ++i) {
+    if ((Free & Sweeps[i]) == Sweeps[i]) {
+      Result |= 1u << i;
+    }
+  }
+  return Result;
+}
+
+/**
+ * @brief Update recomputes the masks which may sweep a changed Node, those
+ * of the Node and its 26 neighbors
+ * @param coordinates_ has a type Vec3i and stores the coordinates
+ * @return void
+ */
+void Passability_Map::Update(Vec3i coordinates_) {
+  for (int Counter_Z = -1; Counter_Z <= 1; ++Counter_Z) {
+    for (int Counter_Y = -1; Counter_Y <= 1; ++Counter_Y) {
+      for (int Counter_X = -1; Counter_X <= 1; ++Counter_X) {
+        Vec3i Around = { coordinates_.x + Counter_X,
+          coordinates_.y + Counter_Y, coordinates_.z + Counter_Z };
+        if (Map.Inside(Around)) {
+          Masks[Map.Index(Around)] = Compute(Around);
+        }
+      }
+    }
+  }
+}
+
+/** Destructor for Passability_Map Class */
+Passability_Map::~Passability_Map() {
+}
@@ -37,6 +37,10 @@
 #include <vector>
 #include <set>
 #include "../include/Planner.h"
+#include "../include/Occupancy_Map.h"
+#include "../include/Goal_Bounding.h"
+#include "../include/Passability_Map.h"
+#include "../include/Snapshot_Map.h"
 
 /**
  * @brief Constructor for Node Struct
@@ -50,6 +54,7 @@ Node::Node(Vec3i coordinates_, Node *Parent_)
     : coordinates(coordinates_) {
   Parent = Parent_;
   G = H = 0;
+  Checked = false;
 }
 
 /**
@@ -66,7 +71,7 @@ double Node::Get_Score() {
  * It compares the X,Y,Z, values of given coordinate with reference
  * @return boolean true if coordinate matches the reference else return false
  */
-bool Vec3i::operator ==(const Vec3i& coordinates_) {
+bool Vec3i::operator ==(const Vec3i& coordinates_) const {
   return (x == coordinates_.x && y == coordinates_.y && z == coordinates_.z);
 }
 
@@ -86,8 +91,13 @@ Vec3i operator +(const Vec3i& left_, const Vec3i& right_) {
  * Set of possible Directions
  * @param direction of type double initializes set of possible Directions
  * @param World_Size of size Vec3i which stores the World Size
+ * @param Lazy_Collision and Collision_Memo are initialized to false
  */
-Planner::Planner(Vec3i World_Size_) {
+Planner::Planner(Vec3i World_Size_)
+    : pinned(nullptr),
+      Lazy_Collision(false),
+      Collision_Memo(false),
+      Collision_Checks(0) {
   Set_Heuristic(&Planner::Euclidean);  ///< Set default heuristic to Euclidean
   direction = {
     { 0 , 0 , 1}, {0 , 1, 0}, {1, 0, 0}, {0, 0, -1},
@@ -111,6 +121,24 @@ void Planner::Set_Heuristic(std::function<double(Vec3i, Vec3i)> heuristic_) {
                         std::placeholders::_2);
 }
 
+/**
+ * @brief Set_Lazy_Collision turns lazy collision checking on or off
+ * @param Lazy_ of type bool
+ * @return void
+ */
+void Planner::Set_Lazy_Collision(bool Lazy_) {
+  Lazy_Collision = Lazy_;
+}
+
+/**
+ * @brief Set_Collision_Memo turns memoization of collision checks on or off
+ * @param Memo_ of type bool
+ * @return void
+ */
+void Planner::Set_Collision_Memo(bool Memo_) {
+  Collision_Memo = Memo_;
+}
+
 /**
  * @brief Add_Collision adds the Collision point to the walls list
  * @cordinates_ of type Vec3i contains the coordinates list of Obstacle
@@ -118,6 +146,77 @@ void Planner::Set_Heuristic(std::function<double(Vec3i, Vec3i)> heuristic_) {
  */
 void Planner::Add_Collision(Vec3i coordinates_) {
   walls.push_back(coordinates_);
+  if (passability) {
+    passability->Set(coordinates_);
+  }
+}
+
+/**
+ * @brief Set_Occupancy sets a map whose Obstacles are checked with the walls
+ * @param occupancy_ of type shared pointer to an Occupancy_Map of the same
+ * World Size, or null to use the walls only
+ * @return false if masks of passable moves are set, in which case no map is
+ * set
+ */
+bool Planner::Set_Occupancy(std::shared_ptr<const Occupancy_Map> occupancy_) {
+  if (occupancy_ && passability) {
+    occupancy.reset();
+    return false;
+  }
+  occupancy = std::move(occupancy_);
+  return true;
+}
+
+/**
+ * @brief Set_Snapshot sets a map whose Obstacles are read once per query
+ * @param snapshots_ of type shared pointer to a Snapshot_Map, or null to
+ * use the walls only
+ * @return false if masks of passable moves are set, in which case no map is
+ * set
+ */
+bool Planner::Set_Snapshot(std::shared_ptr<const Snapshot_Map> snapshots_) {
+  if (snapshots_ && passability) {
+    snapshots.reset();
+    return false;
+  }
+  snapshots = std::move(snapshots_);
+  return true;
+}
+
+/**
+ * @brief Set_Goal_Bounding sets the table used to prune neighbors
+ * @param bounding_ of type shared pointer to a Goal_Bounding built from
+ * this Planner, or null to expand every neighbor
+ * @return false if the table does not match the World and Directions or
+ * masks of passable moves are set, in which case no table is set
+ */
+bool Planner::Set_Goal_Bounding(
+    std::shared_ptr<const Goal_Bounding> bounding_) {
+  if (bounding_ && (passability || bounding_->Empty()
+      || !(bounding_->World_Size == World_Size)
+      || bounding_->Directions != static_cast<int>(direction.size()))) {
+    bounding.reset();
+    return false;
+  }
+  bounding = std::move(bounding_);
+  return true;
+}
+
+/**
+ * @brief Set_Passability sets the masks of passable moves
+ * @param passability_ of type shared pointer to a Passability_Map built
+ * from this Planner, or null to check the neighbors for collisions
+ * @return false if a Goal_Bounding table is set, whose boxes may only be
+ * reached by cutting corners, or an occupancy or Snapshot_Map is set, whose
+ * Obstacles findPath would not check, in which case no masks are set
+ */
+bool Planner::Set_Passability(std::shared_ptr<Passability_Map> passability_) {
+  if (passability_ && (bounding || occupancy || snapshots)) {
+    passability.reset();
+    return false;
+  }
+  passability = std::move(passability_);
+  return true;
 }
 
 /**
@@ -130,17 +229,50 @@ std::vector<Vec3i> Planner::findPath(Vec3i Start_, Vec3i Goal_) {
   Node *current = nullptr;  ///< Set Current Node pointer as Null pointer
   std::set<Node*> Open_Set, Closed_Set;  ///< Initialize the Open & Closed Sets
   Open_Set.insert(new Node(Start_));  ///< Insert Start node to Open Set
+  (*Open_Set.begin())->Checked = true;  ///< Start Node is never checked
+  Collision_Checks = 0;
+  /** View pins one Version of the Snapshot_Map for the whole query */
+  std::unique_ptr<Snapshot_Map::Snapshot> View;
+  if (snapshots) {
+    View.reset(new Snapshot_Map::Snapshot(snapshots->Read()));
+  }
+  pinned = View.get();
+  /** Memo stores 0 for unchecked, 1 for free and 2 for colliding Nodes */
+  std::vector<uint8_t> Memo;
+  if (Collision_Memo) {
+    Memo.assign(static_cast<std::size_t>(World_Size.x) * World_Size.y
+                * World_Size.z, 0);
+  }
 
   while (true) {
     /** Set current node pointer to First node of Open Set */
     current = *Open_Set.begin();
 
-    /** Search for the node with least F value and set it as Current Node */
+    /**
+     * Search for the node with least F value and set it as Current Node.
+     * Ties never depend on where the Nodes were allocated.
+     */
     for (auto node : Open_Set) {
-      if (node->Get_Score() <= current->Get_Score()) {
+      if (Expands_Before(node, current)) {
         current = node;
       }
     }
+
+    /** In Lazy mode, check the Current Node only now that it is selected */
+    if (!current->Checked) {
+      current->Checked = true;
+      if (Check_Collision(current->coordinates, Memo)) {
+        Closed_Set.insert(current);
+        Open_Set.erase(current);
+        if (Open_Set.empty()) {
+          std::cout << "Path Not Found";
+          current = current->Parent;  ///< Expanded, so checked and free
+          break;
+        }
+        continue;
+      }
+    }
+
     /** If Current Node is Goal, Then Stop Searching */
     if (current->coordinates == Goal_) {
       break;
@@ -151,11 +283,26 @@ std::vector<Vec3i> Planner::findPath(Vec3i Start_, Vec3i Goal_) {
 
     /** Remove Current Node from Open Set*/
     Open_Set.erase(std::find(Open_Set.begin(), Open_Set.end(), current));
-    /** From all movable directions, check the neighbors*/
-    for (double i = 0; i < 26; ++i) {
+    /**
+     * From all movable directions, check the neighbors. With passability
+     * only the passable moves are visited, lowest bit first.
+     */
+    uint32_t Moves = passability ? passability->Mask(current->coordinates)
+        : (1u << 26) - 1;
+    for (; Moves != 0; Moves &= Moves - 1) {
+      int i = Passability_Map::Lowest_Move(Moves);
       Vec3i newCoordinates(current->coordinates + direction[i]);
-      /** Check if Collision Happens */
-      if (Detect_Collision(newCoordinates)
+      /** Skip moves that start no shortest path to the Goal */
+      if (bounding && !bounding->Allows(current->coordinates, i, Goal_)) {
+        continue;
+      }
+      /**
+       * Check if Collision Happens. Lazy mode only rejects Nodes outside the
+       * World here and leaves the Obstacles to the selection above. Passable
+       * moves need no check.
+       */
+      if ((!passability && (Lazy_Collision ? !Inside_World(newCoordinates)
+          : Check_Collision(newCoordinates, Memo)))
           || Find_Node(Closed_Set, newCoordinates)) {
         continue;
       }
@@ -167,6 +314,7 @@ std::vector<Vec3i> Planner::findPath(Vec3i Start_, Vec3i Goal_) {
         successor = new Node(newCoordinates, current);
         successor->G = Total_Cost;
         successor->H = heuristic(successor->coordinates, Goal_);
+        successor->Checked = passability || !Lazy_Collision;
         Open_Set.insert(successor);
       } else if (Total_Cost < successor->G) {
         /** Set Parent Node to Successor Node */
@@ -187,9 +335,33 @@ std::vector<Vec3i> Planner::findPath(Vec3i Start_, Vec3i Goal_) {
     path.push_back(current->coordinates);
     current = current->Parent;
   }
+  pinned = nullptr;
   return path;  ///< Return Calculated path
 }
 
+/**
+ * @brief Expands_Before orders the Open Set by least F value. Ties prefer
+ * the higher G value, which is closer to the Goal on plateaus, and then the
+ * lower z, y and x coordinates.
+ * @param left_ of type pointer to Node
+ * @param right_ of type pointer to Node
+ * @return true if left_ is expanded before right_
+ */
+bool Planner::Expands_Before(Node *left_, Node *right_) {
+  if (left_->Get_Score() != right_->Get_Score()) {
+    return left_->Get_Score() < right_->Get_Score();
+  }
+  if (left_->G != right_->G) {
+    return left_->G > right_->G;
+  }
+  const Vec3i& Left = left_->coordinates;
+  const Vec3i& Right = right_->coordinates;
+  if (Left.z != Right.z) {
+    return Left.z < Right.z;
+  }
+  return Left.y != Right.y ? Left.y < Right.y : Left.x < Right.x;
+}
+
 /**
  * @brief Find_Node finds the node representing given coordinates in Nodes list
  * @param nodes_ Nodes list
@@ -214,12 +386,50 @@ bool Planner::Detect_Collision(Vec3i coordinates_) {
   if (coordinates_.x < 0 || coordinates_.x >= World_Size.x || coordinates_.y < 0
       || coordinates_.y >= World_Size.y || coordinates_.z < 0
       || coordinates_.z >= World_Size.z
+      || (occupancy && occupancy->Is_Occupied(coordinates_))
+      || (pinned && pinned->Is_Occupied(coordinates_))
       || std::find(walls.begin(), walls.end(), coordinates_) != walls.end()) {
     return true;  ///< return true of collision happens
   }
   return false;  ///< return false if collision doesn't happen
 }
 
+/**
+ * @brief Inside_World checks if the point lies inside the World
+ * @param coordinates_ has a type Vec3i and stores the coordinates
+ * @return true if point lies inside the World else false
+ */
+bool Planner::Inside_World(Vec3i coordinates_) {
+  return coordinates_.x >= 0 && coordinates_.x < World_Size.x
+      && coordinates_.y >= 0 && coordinates_.y < World_Size.y
+      && coordinates_.z >= 0 && coordinates_.z < World_Size.z;
+}
+
+/**
+ * @brief Check_Collision counts and memoizes calls to Detect_Collision for
+ * Nodes inside the World
+ * @param coordinates_ has a type Vec3i and stores the coordinates
+ * @param Memo_ has type uint8_t vector with one entry per Node of the World,
+ * or is empty to check every time
+ * @return true if point lies inside the obstacle else false
+ */
+bool Planner::Check_Collision(Vec3i coordinates_, std::vector<uint8_t>& Memo_) {
+  if (!Inside_World(coordinates_)) {
+    return true;  ///< Outside the World, nothing to look up
+  }
+  if (Memo_.empty()) {
+    ++Collision_Checks;
+    return Detect_Collision(coordinates_);
+  }
+  uint8_t& Known = Memo_[(static_cast<std::size_t>(coordinates_.z)
+      * World_Size.y + coordinates_.y) * World_Size.x + coordinates_.x];
+  if (Known == 0) {
+    ++Collision_Checks;
+    Known = Detect_Collision(coordinates_) ? 2 : 1;
+  }
+  return Known == 2;
+}
+
 /**
  * @brief Distance gives the distance between two points
  * @param Now_ has type Vec3i struct
@@ -254,6 +464,50 @@ double Planner::Manhattan(Vec3i Now_, Vec3i Neighbor_) {
   return static_cast<double>(100 * (delta.x + delta.y + delta.z));
 }
 
+/**
+ * @brief Octile is an Octile Distance Heuristic function. It is the cost of
+ * the cheapest obstacle free path on the 26 connected grid, so unlike
+ * Euclidean and Manhattan it never overestimates and is consistent.
+ * @param Now_ has type Vec3i struct
+ * @param Neighbor_ has type Vec3i struct
+ * @return double type Octile Distance between two points
+ */
+double Planner::Octile(Vec3i Now_, Vec3i Neighbor_) {
+  auto delta = Distance(Now_, Neighbor_);
+  int d[3] = { delta.x, delta.y, delta.z };
+  std::sort(d, d + 3);  ///< d[0] <= d[1] <= d[2]
+  return static_cast<double>(173 * d[0] + 141 * (d[1] - d[0])
+      + 100 * (d[2] - d[1]));
+}
+
+/**
+ * @brief Step_Cost gives the cost of a single move used by findPath
+ * @param Move_ has type Vec3i struct and stores one of the directions
+ * @return 100 for straight, 141 for planar diagonal and 173 for cubic
+ * diagonal moves
+ */
+int Planner::Step_Cost(Vec3i Move_) {
+  int Axes = (Move_.x != 0) + (Move_.y != 0) + (Move_.z != 0);
+  return (Axes == 1) ? 100 : ((Axes == 2) ? 141 : 173);
+}
+
+/**
+ * @brief Path_Cost adds the Step Costs along a path
+ * @param path_ has type Vec3i vector and stores a path returned by findPath
+ * @return double type total cost of the path
+ */
+double Planner::Path_Cost(const std::vector<Vec3i>& path_) {
+  double Cost = 0;
+  for (std::size_t i = 1; i < path_.size(); ++i) {
+    Cost += Step_Cost(Distance(path_[i], path_[i - 1]));
+  }
+  return Cost;
+}
+
+/** Destructor for Occupancy_View Class */
+Occupancy_View::~Occupancy_View() {
+}
+
 /** Destructor for Planner Class */
 Planner::~Planner() {
 }
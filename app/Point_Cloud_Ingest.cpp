@@ -0,0 +1,264 @@
+/**
+ * @file Point_Cloud_Ingest.cpp
+ * @brief This file contains the code for Point_Cloud_Ingest class which turns
+ * batches of sensor points into Obstacle Nodes on its own thread.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* --Includes-- */
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <utility>
+#include <vector>
+#include "../include/Point_Cloud_Ingest.h"
+
+/**
+ * @brief Constructor for Point_Cloud_Ingest Class
+ * @param Geometry_ has type Grid_Geometry and describes the Workspace
+ * @param Clear_Free_Space_ has type bool and enables ray clearing
+ * @param Max_Queued_ has type size_t and bounds the waiting scans
+ */
+Point_Cloud_Ingest::Point_Cloud_Ingest(const Grid_Geometry& Geometry_,
+                                       bool Clear_Free_Space_,
+                                       std::size_t Max_Queued_)
+    : Pending(0),
+      Stopping(false),
+      Front(std::make_shared<Occupancy_Map>(Geometry_.World)),
+      Back(std::make_shared<Occupancy_Map>(Geometry_.World)),
+      Geometry(Geometry_),
+      Clear_Free_Space(Clear_Free_Space_),
+      Max_Queued(std::max<std::size_t>(Max_Queued_, 1)),
+      Points(0),
+      Batches(0),
+      Dropped(0) {
+  Worker = std::thread(&Point_Cloud_Ingest::Run, this);
+}
+
+/**
+ * @brief Push queues a scan for the ingest thread
+ * @param Points_ has type Vec3d vector and stores the points hit by the sensor
+ * @param Origin_ has type Vec3d and stores the position of the sensor
+ * @return void
+ */
+void Point_Cloud_Ingest::Push(std::vector<Vec3d> Points_, Vec3d Origin_) {
+  {
+    std::lock_guard<std::mutex> Lock(Queue_Mutex);
+    if (Queue.size() >= Max_Queued) {
+      Queue.pop_front();  ///< Drop the oldest scan, the sensor is too fast
+      --Pending;
+      ++Dropped;
+    }
+    Queue.push_back({std::move(Points_), Origin_});
+    ++Pending;
+  }
+  Queue_Ready.notify_one();
+}
+
+/**
+ * @brief Flush waits until every pushed scan has been published
+ * @return void
+ */
+void Point_Cloud_Ingest::Flush() {
+  std::unique_lock<std::mutex> Lock(Queue_Mutex);
+  Queue_Done.wait(Lock, [this]() { return Pending == 0; });
+}
+
+/**
+ * @brief Snapshot gives the latest published map
+ * @return shared pointer to an Occupancy_Map which is never modified again
+ */
+std::shared_ptr<const Occupancy_Map> Point_Cloud_Ingest::Snapshot() const {
+  return std::atomic_load(&Front);
+}
+
+/**
+ * @brief Run ingests queued scans into the back map and publishes it. The
+ * previous front map becomes the new back map once no planner holds it and
+ * is brought up to date by copying only the Nodes changed since.
+ * @return void
+ */
+void Point_Cloud_Ingest::Run() {
+  std::vector<std::size_t> Changed;
+  while (true) {
+    Batch Scan;
+    {
+      std::unique_lock<std::mutex> Lock(Queue_Mutex);
+      Queue_Ready.wait(Lock, [this]() { return Stopping || !Queue.empty(); });
+      if (Queue.empty()) {
+        return;  ///< Stopping with nothing left to ingest
+      }
+      Scan = std::move(Queue.front());
+      Queue.pop_front();
+    }
+
+    /** Bring Back up to date with Front */
+    if (Back.use_count() > 1) {
+      Back = std::make_shared<Occupancy_Map>(*Front);  ///< Still being read
+    } else {
+      std::atomic_thread_fence(std::memory_order_acquire);
+      for (std::size_t Cell : Lag) {
+        Back->Cells[Cell] = Front->Cells[Cell];
+      }
+    }
+
+    Changed.clear();
+    Apply(Scan.Points, Scan.Origin, *Back, &Changed);
+    Points += Scan.Points.size();
+    ++Batches;
+
+    /** Publish Back and keep the old Front to be reused as Back */
+    std::shared_ptr<const Occupancy_Map> Published = Back;
+    std::shared_ptr<const Occupancy_Map> Old = std::atomic_exchange(
+        &Front, Published);
+    Back = std::const_pointer_cast<Occupancy_Map>(Old);
+    Lag.swap(Changed);
+
+    {
+      std::lock_guard<std::mutex> Lock(Queue_Mutex);
+      --Pending;
+    }
+    Queue_Done.notify_all();
+  }
+}
+
+/**
+ * @brief Apply voxelizes a scan and marks the hit Nodes as Obstacles
+ * @param Points_ has type Vec3d vector and stores the points hit by the sensor
+ * @param Origin_ has type Vec3d and stores the position of the sensor
+ * @param Map_ is the map to update
+ * @param Changed_ receives the positions of the Nodes which changed
+ * @return number of distinct Obstacle Nodes in the scan
+ */
+std::size_t Point_Cloud_Ingest::Apply(const std::vector<Vec3d>& Points_,
+                                      Vec3d Origin_, Occupancy_Map& Map_,
+                                      std::vector<std::size_t>* Changed_) {
+  /** Voxelize the whole scan at once with SIMD */
+  std::vector<Vec3i> Cells(Points_.size());
+  Geometry.To_Cells(Points_.data(), Points_.size(), Cells.data());
+
+  /** Keep each Node inside the World once */
+  std::vector<std::size_t> Hits;
+  Hits.reserve(Cells.size());
+  for (std::size_t i = 0; i < Cells.size(); ++i) {
+    if (Geometry.Contains(Points_[i]) && Map_.Inside(Cells[i])) {
+      Hits.push_back(Map_.Index(Cells[i]));
+    }
+  }
+  std::sort(Hits.begin(), Hits.end());
+  Hits.erase(std::unique(Hits.begin(), Hits.end()), Hits.end());
+
+  /** Clear the free space seen by the sensor, one ray per hit Node */
+  if (Clear_Free_Space) {
+    for (std::size_t Cell : Hits) {
+      Vec3d Center = Geometry.To_Point(Map_.Coordinates(Cell));
+      Center = {Center.x + 0.5 * Geometry.Resolution.x,
+                Center.y + 0.5 * Geometry.Resolution.y,
+                Center.z + 0.5 * Geometry.Resolution.z};
+      Clear_Ray(Origin_, Center, Map_, Changed_);
+    }
+  }
+
+  for (std::size_t Cell : Hits) {
+    if (Map_.Cells[Cell] == 0) {
+      Map_.Cells[Cell] = 1;
+      if (Changed_ != nullptr) {
+        Changed_->push_back(Cell);
+      }
+    }
+  }
+  return Hits.size();
+}
+
+/**
+ * @brief Clear_Ray clears every Node crossed by the segment from the sensor
+ * to a hit, except the Node of the hit, using the 3D DDA of Amanatides and
+ * Woo. The segment is walked in units of Nodes, stepping each time to the
+ * next Node boundary along the axis which reaches it first.
+ * @param From_ has type Vec3d and stores the position of the sensor
+ * @param To_ has type Vec3d and stores the hit point
+ * @param Map_ is the map to update
+ * @param Changed_ receives the positions of the Nodes which changed
+ * @return void
+ */
+void Point_Cloud_Ingest::Clear_Ray(Vec3d From_, Vec3d To_, Occupancy_Map& Map_,
+                                   std::vector<std::size_t>* Changed_) {
+  const double Start[3] = {
+    (From_.x - Geometry.Boundary.Min.x) / Geometry.Resolution.x,
+    (From_.y - Geometry.Boundary.Min.y) / Geometry.Resolution.y,
+    (From_.z - Geometry.Boundary.Min.z) / Geometry.Resolution.z };
+  const double End[3] = {
+    (To_.x - Geometry.Boundary.Min.x) / Geometry.Resolution.x,
+    (To_.y - Geometry.Boundary.Min.y) / Geometry.Resolution.y,
+    (To_.z - Geometry.Boundary.Min.z) / Geometry.Resolution.z };
+  int Cell[3], Last[3], Step[3];
+  double Next[3], Delta[3];
+  int Steps = 0;
+  for (int Axis = 0; Axis < 3; ++Axis) {
+    Cell[Axis] = static_cast<int>(std::floor(Start[Axis]));
+    Last[Axis] = static_cast<int>(std::floor(End[Axis]));
+    double Direction = End[Axis] - Start[Axis];
+    Step[Axis] = (Direction > 0) ? 1 : -1;
+    if (Direction == 0) {
+      Next[Axis] = Delta[Axis] = std::numeric_limits<double>::infinity();
+    } else {
+      double Boundary = Cell[Axis] + ((Step[Axis] > 0) ? 1 : 0);
+      Next[Axis] = (Boundary - Start[Axis]) / Direction;
+      Delta[Axis] = std::abs(1.0 / Direction);
+    }
+    Steps += std::abs(Last[Axis] - Cell[Axis]);
+  }
+  for (; Steps > 0; --Steps) {
+    Vec3i Crossed = {Cell[0], Cell[1], Cell[2]};
+    if (Map_.Inside(Crossed)) {
+      std::size_t Index = Map_.Index(Crossed);
+      if (Map_.Cells[Index] != 0) {
+        Map_.Cells[Index] = 0;
+        if (Changed_ != nullptr) {
+          Changed_->push_back(Index);
+        }
+      }
+    }
+    int Axis = (Next[0] < Next[1]) ? ((Next[0] < Next[2]) ? 0 : 2)
+        : ((Next[1] < Next[2]) ? 1 : 2);
+    Cell[Axis] += Step[Axis];
+    Next[Axis] += Delta[Axis];
+  }
+}
+
+/**
+ * @brief Destructor of Point_Cloud_Ingest Class. Ingests the scans still
+ * queued and stops the ingest thread.
+ */
+Point_Cloud_Ingest::~Point_Cloud_Ingest() {
+  {
+    std::lock_guard<std::mutex> Lock(Queue_Mutex);
+    Stopping = true;
+  }
+  Queue_Ready.notify_one();
+  Worker.join();
+}
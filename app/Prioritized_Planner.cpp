@@ -0,0 +1,74 @@
+/**
+ * @file Prioritized_Planner.cpp
+ * @brief This file contains the code for Prioritized_Planner class which
+ * plans a fleet of robots one after the other.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* --Includes-- */
+#include <vector>
+#include "../include/Prioritized_Planner.h"
+
+/**
+ * @brief Constructor for class Prioritized_Planner
+ * @param Plan_ is the Planner whose World, Obstacles, Directions and
+ * Heuristic are used for every robot
+ */
+Prioritized_Planner::Prioritized_Planner(const Planner& Plan_)
+    : Single(Plan_),
+      Failed(0) {
+}
+
+/**
+ * @brief findPaths Finds the paths of all robots in priority order
+ * @param Starts_ of type Vec3i vector stores the Start of each robot
+ * @param Goals_ of type Vec3i vector stores the Goal of each robot
+ * @return one path per robot indexed by time step
+ */
+std::vector<std::vector<Vec3i>> Prioritized_Planner::findPaths(
+    const std::vector<Vec3i>& Starts_, const std::vector<Vec3i>& Goals_) {
+  Table.Clear();
+  Failed = 0;
+  std::vector<std::vector<Vec3i>> paths(Starts_.size());
+  for (std::size_t Agent = 0; Agent < Starts_.size(); ++Agent) {
+    paths[Agent] = Single.findPath(Starts_[Agent], Goals_[Agent], Table);
+    /** Only a World larger than a Reservation_Table key holds fails here */
+    if (!paths[Agent].empty()
+        && Table.Reserve_Path(paths[Agent], static_cast<int>(Agent))) {
+      continue;
+    }
+    /** The robot never leaves its Start, park it there for all time */
+    paths[Agent].clear();
+    ++Failed;
+    Table.Reserve_Path(std::vector<Vec3i>(1, Starts_[Agent]),
+                       static_cast<int>(Agent));
+  }
+  return paths;
+}
+
+/** Destructor for Prioritized_Planner Class */
+Prioritized_Planner::~Prioritized_Planner() {
+}
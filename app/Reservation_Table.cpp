@@ -0,0 +1,311 @@
+/**
+ * @file Reservation_Table.cpp
+ * @brief This file contains the code for Reservation_Table class which
+ * records the Nodes claimed by the paths of other agents over time.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* --Includes-- */
+#include <algorithm>
+#include <vector>
+#include "../include/Reservation_Table.h"
+
+namespace {
+
+/** Empty marks a free Slot, it has entry kind 3 which is never used */
+const uint64_t Empty = ~0ULL;
+/** Entry kinds stored in the lowest two bits of a key */
+const int Held = 0, Parked = 1, Latest = 2;
+/** Initial number of Slots */
+const std::size_t Initial_Slots = 1024;
+
+/**
+ * @brief Mix scatters the bits of a key over the whole word (splitmix64)
+ * @param Key_ has type uint64_t
+ * @return hashed key of type uint64_t
+ */
+uint64_t Mix(uint64_t Key_) {
+  Key_ = (Key_ ^ (Key_ >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  Key_ = (Key_ ^ (Key_ >> 27)) * 0x94D049BB133111EBULL;
+  return Key_ ^ (Key_ >> 31);
+}
+
+}  // namespace
+
+const int Reservation_Table::Max_Coordinate;
+const int Reservation_Table::Max_Time;
+
+/**
+ * @brief Constructor for class Reservation_Table
+ * @param Keys and Values start with Initial_Slots empty Slots
+ */
+Reservation_Table::Reservation_Table()
+    : Keys(Initial_Slots, Empty),
+      Values(Initial_Slots, -1),
+      Used(0),
+      Last(-1) {
+}
+
+/**
+ * @brief Key packs 15 bits of each coordinate, 17 bits of time step and 2
+ * bits of entry kind into one word. Callers check In_Range first.
+ * @param coordinates_ has type Vec3i and stores the Node
+ * @param Time_ has type int and stores the time step
+ * @param Kind_ has type int and stores the entry kind
+ * @return packed key of type uint64_t
+ */
+uint64_t Reservation_Table::Key(Vec3i coordinates_, int Time_, int Kind_) {
+  return (static_cast<uint64_t>(coordinates_.x & 0x7FFF) << 49)
+      | (static_cast<uint64_t>(coordinates_.y & 0x7FFF) << 34)
+      | (static_cast<uint64_t>(coordinates_.z & 0x7FFF) << 19)
+      | (static_cast<uint64_t>(Time_ & 0x1FFFF) << 2)
+      | static_cast<uint64_t>(Kind_);
+}
+
+/**
+ * @brief In_Range checks that a Node and time step fit in a key without
+ * being cut, which would make different entries share a key
+ * @param coordinates_ has type Vec3i and stores the Node
+ * @param Time_ has type int and stores the time step
+ * @return true if the key holds them exactly
+ */
+bool Reservation_Table::In_Range(Vec3i coordinates_, int Time_) {
+  return coordinates_.x >= 0 && coordinates_.x <= Max_Coordinate
+      && coordinates_.y >= 0 && coordinates_.y <= Max_Coordinate
+      && coordinates_.z >= 0 && coordinates_.z <= Max_Coordinate
+      && Time_ >= 0 && Time_ <= Max_Time;
+}
+
+/**
+ * @brief Find probes the table linearly from the hash of a key
+ * @param Key_ has type uint64_t
+ * @return index of the Slot holding the key or of the empty Slot ending the
+ * probe sequence
+ */
+std::size_t Reservation_Table::Find(uint64_t Key_) const {
+  std::size_t Mask = Keys.size() - 1;
+  std::size_t i = Mix(Key_) & Mask;
+  while (Keys[i] != Key_ && Keys[i] != Empty) {
+    i = (i + 1) & Mask;
+  }
+  return i;
+}
+
+/**
+ * @brief Insert sets the value of a key. The table doubles once it is half
+ * full, which keeps probe sequences short.
+ * @param Key_ has type uint64_t
+ * @param Value_ has type int32_t
+ * @return void
+ */
+void Reservation_Table::Insert(uint64_t Key_, int32_t Value_) {
+  if (2 * (Used + 1) > Keys.size()) {
+    std::vector<uint64_t> Old_Keys(Keys.size() * 2, Empty);
+    std::vector<int32_t> Old_Values(Values.size() * 2, -1);
+    Old_Keys.swap(Keys);
+    Old_Values.swap(Values);
+    for (std::size_t i = 0; i < Old_Keys.size(); ++i) {
+      if (Old_Keys[i] != Empty) {
+        std::size_t Slot = Find(Old_Keys[i]);
+        Keys[Slot] = Old_Keys[i];
+        Values[Slot] = Old_Values[i];
+      }
+    }
+  }
+  std::size_t Slot = Find(Key_);
+  if (Keys[Slot] == Empty) {
+    Keys[Slot] = Key_;
+    ++Used;
+  }
+  Values[Slot] = Value_;
+}
+
+/**
+ * @brief Lookup gives the value of a key
+ * @param Key_ has type uint64_t
+ * @return value of the key or -1 if it is missing
+ */
+int32_t Reservation_Table::Lookup(uint64_t Key_) const {
+  std::size_t Slot = Find(Key_);
+  return (Keys[Slot] == Empty) ? -1 : Values[Slot];
+}
+
+/**
+ * @brief Reserve claims a Node at a time step for an agent
+ * @param coordinates_ has type Vec3i and stores the Node
+ * @param Time_ has type int and stores the time step
+ * @param Agent_ has type int and stores the agent
+ * @return false if the Node or time step is outside the limits of a key
+ */
+bool Reservation_Table::Reserve(Vec3i coordinates_, int Time_, int Agent_) {
+  if (!In_Range(coordinates_, Time_)) {
+    return false;
+  }
+  Insert(Key(coordinates_, Time_, Held), Agent_);
+  if (Lookup(Key(coordinates_, 0, Latest)) < Time_) {
+    Insert(Key(coordinates_, 0, Latest), Time_);
+  }
+  Last = std::max(Last, Time_);
+  return true;
+}
+
+/**
+ * @brief Reserve_Path claims every Node of a path and parks the agent on
+ * its last Node
+ * @param path_ has type Vec3i vector, path_[i] is the Node at time step
+ * Start_Time_ + i
+ * @param Agent_ has type int and stores the agent
+ * @param Start_Time_ has type int and stores the time step of path_[0]
+ * @return false if a Node or time step is outside the limits of a key
+ */
+bool Reservation_Table::Reserve_Path(const std::vector<Vec3i>& path_,
+                                     int Agent_, int Start_Time_) {
+  if (path_.empty()) {
+    return true;
+  }
+  if (Start_Time_ < 0 || static_cast<long long>(Start_Time_) + path_.size()
+      - 1 > Max_Time) {
+    return false;
+  }
+  for (const Vec3i& coordinates : path_) {
+    if (!In_Range(coordinates, Start_Time_)) {
+      return false;
+    }
+  }
+  for (std::size_t i = 0; i < path_.size(); ++i) {
+    Reserve(path_[i], Start_Time_ + static_cast<int>(i), Agent_);
+  }
+  Insert(Key(path_.back(), 0, Parked),
+         Start_Time_ + static_cast<int>(path_.size()) - 1);
+  return true;
+}
+
+/**
+ * @brief Owner finds the agent holding a Node at a time step, including an
+ * agent parked on the Node
+ * @param coordinates_ has type Vec3i and stores the Node
+ * @param Time_ has type int and stores the time step
+ * @return agent or -1 if the Node is free
+ */
+int Reservation_Table::Owner(Vec3i coordinates_, int Time_) const {
+  if (!In_Range(coordinates_, 0)) {
+    return -1;
+  }
+  /** Parked agents stay past Max_Time, nothing else is reserved there */
+  int32_t Since = Lookup(Key(coordinates_, 0, Parked));
+  if (Time_ < 0 || Time_ > Max_Time) {
+    return (Since >= 0 && Time_ >= Since)
+        ? Lookup(Key(coordinates_, Since, Held)) : -1;
+  }
+  int32_t Agent = Lookup(Key(coordinates_, Time_, Held));
+  if (Agent >= 0) {
+    return Agent;
+  }
+  if (Since >= 0 && Time_ >= Since) {
+    return Lookup(Key(coordinates_, Since, Held));
+  }
+  return -1;
+}
+
+/**
+ * @brief Is_Free checks if no agent holds a Node at a time step
+ * @param coordinates_ has type Vec3i and stores the Node
+ * @param Time_ has type int and stores the time step
+ * @return true if the Node is free
+ */
+bool Reservation_Table::Is_Free(Vec3i coordinates_, int Time_) const {
+  return Owner(coordinates_, Time_) < 0;
+}
+
+/**
+ * @brief Can_Move checks a move for vertex and swap conflicts
+ * @param From_ has type Vec3i and stores the Node at time step Time_
+ * @param To_ has type Vec3i and stores the Node at time step Time_ + 1
+ * @param Time_ has type int
+ * @return true if the move is free of conflicts
+ */
+bool Reservation_Table::Can_Move(Vec3i From_, Vec3i To_, int Time_) const {
+  if (!Is_Free(To_, Time_ + 1)) {
+    return false;
+  }
+  int Other = Owner(To_, Time_);
+  return Other < 0 || Owner(From_, Time_ + 1) != Other;
+}
+
+/**
+ * @brief Can_Park checks if an agent can stay on a Node forever
+ * @param coordinates_ has type Vec3i and stores the Node
+ * @param Time_ has type int and stores the first time step on the Node
+ * @return true if no agent uses the Node at or after the time step
+ */
+bool Reservation_Table::Can_Park(Vec3i coordinates_, int Time_) const {
+  if (!In_Range(coordinates_, 0)) {
+    return true;
+  }
+  return Lookup(Key(coordinates_, 0, Latest)) < Time_
+      && Lookup(Key(coordinates_, 0, Parked)) < 0;
+}
+
+/**
+ * @brief Last_Time gives the last time step reserved by any agent
+ * @return time step, -1 if the table is empty
+ */
+int Reservation_Table::Last_Time() const {
+  return Last;
+}
+
+/**
+ * @brief Size gives the number of entries in the table
+ * @return number of entries
+ */
+std::size_t Reservation_Table::Size() const {
+  return Used;
+}
+
+/**
+ * @brief Bytes gives the memory used by the table
+ * @return number of bytes
+ */
+std::size_t Reservation_Table::Bytes() const {
+  return Keys.size() * (sizeof(uint64_t) + sizeof(int32_t));
+}
+
+/**
+ * @brief Clear removes every reservation and shrinks the table
+ * @return void
+ */
+void Reservation_Table::Clear() {
+  Keys.assign(Initial_Slots, Empty);
+  Values.assign(Initial_Slots, -1);
+  Keys.shrink_to_fit();
+  Values.shrink_to_fit();
+  Used = 0;
+  Last = -1;
+}
+
+/** Destructor for Reservation_Table Class */
+Reservation_Table::~Reservation_Table() {
+}
@@ -0,0 +1,318 @@
+/**
+ * @file Snapshot_Map.cpp
+ * @brief This file contains the code for Snapshot_Map class, a chunked
+ * copy-on-write occupancy map with epoch based reclamation.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* --Includes-- */
+#include <algorithm>
+#include <limits>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "../include/Snapshot_Map.h"
+
+/**
+ * @brief Constructor for class Snapshot_Map. Every chunk of the first
+ * Version is the shared empty chunk.
+ * @param World_Size_ of type Vec3i struct stores the World Dimensions
+ * @param Max_Readers_ of type int stores the number of reader slots
+ */
+Snapshot_Map::Snapshot_Map(Vec3i World_Size_, int Max_Readers_)
+    : World_Size(World_Size_),
+      Chunks_Copied(0),
+      Chunk_Count({(World_Size_.x + (1 << Chunk_Bits) - 1) >> Chunk_Bits,
+        (World_Size_.y + (1 << Chunk_Bits) - 1) >> Chunk_Bits,
+        (World_Size_.z + (1 << Chunk_Bits) - 1) >> Chunk_Bits}),
+      Current(nullptr),
+      Global_Epoch(1),
+      Readers(new std::atomic<uint64_t>[std::max(1, Max_Readers_)]),
+      Max_Readers(std::max(1, Max_Readers_)) {
+  Zero.fill(0);
+  for (int i = 0; i < Max_Readers; ++i) {
+    Readers[i].store(0);
+  }
+  std::size_t Count = static_cast<std::size_t>(Chunk_Count.x) * Chunk_Count.y
+      * Chunk_Count.z;
+  Draft.assign(Count, &Zero);
+  Dirty.assign(Count, 0);
+  Current.store(new Version{1, std::vector<const Chunk*>(Count, &Zero)});
+}
+
+/**
+ * @brief Read pins the current epoch in a free reader slot and returns the
+ * current Version. The epoch is pinned before the Version is loaded, so the
+ * writer either sees the pin or has already published a newer Version
+ * which the reader then loads.
+ * @return Snapshot of the current Version
+ */
+Snapshot_Map::Snapshot Snapshot_Map::Read() const {
+  for (;;) {
+    for (int i = 0; i < Max_Readers; ++i) {
+      uint64_t Free = 0;
+      if (Readers[i].load() == 0
+          && Readers[i].compare_exchange_strong(Free, Global_Epoch.load())) {
+        return Snapshot(this, i, Current.load());
+      }
+    }
+    std::this_thread::yield();  ///< Every slot is held, wait for a reader
+  }
+}
+
+/**
+ * @brief Set marks the Node as an Obstacle in the next Version
+ * @param coordinates_ has type Vec3i and stores the Node
+ * @return void
+ */
+void Snapshot_Map::Set(Vec3i coordinates_) {
+  Write(coordinates_, 1);
+}
+
+/**
+ * @brief Clear marks the Node as Free in the next Version
+ * @param coordinates_ has type Vec3i and stores the Node
+ * @return void
+ */
+void Snapshot_Map::Clear(Vec3i coordinates_) {
+  Write(coordinates_, 0);
+}
+
+/**
+ * @brief Add_Walls marks every Node of a walls list as an Obstacle
+ * @param walls_ has type vector of Vec3i and stores the Obstacle Nodes
+ * @return void
+ */
+void Snapshot_Map::Add_Walls(const std::vector<Vec3i>& walls_) {
+  for (const Vec3i& wall : walls_) {
+    Set(wall);
+  }
+}
+
+/**
+ * @brief Publish swaps in a Version made of the draft chunks. The previous
+ * Version and the chunks replaced since are retired with the new epoch.
+ * @return epoch of type uint64_t of the current Version
+ */
+uint64_t Snapshot_Map::Publish() {
+  const Version *Old = Current.load();
+  if (std::find(Dirty.begin(), Dirty.end(), 1) == Dirty.end()) {
+    return Old->Epoch;  ///< Nothing changed
+  }
+  uint64_t Epoch = Old->Epoch + 1;
+  Current.store(new Version{Epoch,
+    std::vector<const Chunk*>(Draft.begin(), Draft.end())});
+  Global_Epoch.store(Epoch);
+  Retired_Versions.push_back({Epoch, Old});
+  for (const Chunk *chunk : Replaced) {
+    Retired_Chunks.push_back({Epoch, chunk});
+  }
+  Replaced.clear();
+  std::fill(Dirty.begin(), Dirty.end(), 0);
+  Reclaim();
+  return Epoch;
+}
+
+/**
+ * @brief Reclaim frees every retired Version and chunk whose epoch is not
+ * newer than the oldest epoch pinned by a reader
+ * @return number of Versions and chunks freed
+ */
+std::size_t Snapshot_Map::Reclaim() {
+  uint64_t Oldest = std::numeric_limits<uint64_t>::max();
+  for (int i = 0; i < Max_Readers; ++i) {
+    uint64_t Pinned = Readers[i].load();
+    if (Pinned != 0) {
+      Oldest = std::min(Oldest, Pinned);
+    }
+  }
+  std::size_t Freed = 0;
+  for (auto& retired : Retired_Versions) {
+    if (retired.first <= Oldest) {
+      delete retired.second;
+      retired.second = nullptr;
+      ++Freed;
+    }
+  }
+  for (auto& retired : Retired_Chunks) {
+    if (retired.first <= Oldest) {
+      delete retired.second;
+      retired.second = nullptr;
+      ++Freed;
+    }
+  }
+  Retired_Versions.erase(std::remove_if(Retired_Versions.begin(),
+      Retired_Versions.end(), [](const std::pair<uint64_t,
+          const Version*>& retired_) { return retired_.second == nullptr; }),
+      Retired_Versions.end());
+  Retired_Chunks.erase(std::remove_if(Retired_Chunks.begin(),
+      Retired_Chunks.end(), [](const std::pair<uint64_t,
+          const Chunk*>& retired_) { return retired_.second == nullptr; }),
+      Retired_Chunks.end());
+  return Freed;
+}
+
+/**
+ * @brief Retired gives the number of Versions and chunks waiting for
+ * readers to move to a newer epoch
+ * @return number of retired Versions and chunks
+ */
+std::size_t Snapshot_Map::Retired() const {
+  return Retired_Versions.size() + Retired_Chunks.size();
+}
+
+/**
+ * @brief Locate gives the chunk of a Node inside the World and the position
+ * of the Node inside the chunk
+ * @param coordinates_ has type Vec3i and stores the Node
+ * @return pair of chunk index and position
+ */
+std::pair<std::size_t, std::size_t> Snapshot_Map::Locate(
+    Vec3i coordinates_) const {
+  const int Mask = (1 << Chunk_Bits) - 1;
+  std::size_t Chunk_Index = ((static_cast<std::size_t>(
+      coordinates_.z >> Chunk_Bits) * Chunk_Count.y
+      + (coordinates_.y >> Chunk_Bits)) * Chunk_Count.x)
+      + (coordinates_.x >> Chunk_Bits);
+  std::size_t Position = (((coordinates_.z & Mask) << Chunk_Bits
+      | (coordinates_.y & Mask)) << Chunk_Bits) | (coordinates_.x & Mask);
+  return {Chunk_Index, Position};
+}
+
+/**
+ * @brief Write changes a Node of the draft. The first write to a chunk
+ * since the last Publish copies it, later writes change the copy in place.
+ * @param coordinates_ has type Vec3i and stores the Node
+ * @param Value_ has type uint8_t, 1 for an Obstacle and 0 for Free
+ * @return void
+ */
+void Snapshot_Map::Write(Vec3i coordinates_, uint8_t Value_) {
+  if (coordinates_.x < 0 || coordinates_.x >= World_Size.x
+      || coordinates_.y < 0 || coordinates_.y >= World_Size.y
+      || coordinates_.z < 0 || coordinates_.z >= World_Size.z) {
+    return;
+  }
+  std::pair<std::size_t, std::size_t> Place = Locate(coordinates_);
+  if ((*Draft[Place.first])[Place.second] == Value_) {
+    return;
+  }
+  if (Dirty[Place.first] == 0) {
+    if (Draft[Place.first] != &Zero) {
+      Replaced.push_back(Draft[Place.first]);
+    }
+    Draft[Place.first] = new Chunk(*Draft[Place.first]);
+    Dirty[Place.first] = 1;
+    ++Chunks_Copied;
+  }
+  (*Draft[Place.first])[Place.second] = Value_;
+}
+
+/**
+ * @brief Destructor for Snapshot_Map Class. Every Snapshot must have been
+ * released.
+ */
+Snapshot_Map::~Snapshot_Map() {
+  for (auto& retired : Retired_Versions) {
+    delete retired.second;
+  }
+  for (auto& retired : Retired_Chunks) {
+    delete retired.second;
+  }
+  for (const Chunk *chunk : Replaced) {
+    delete chunk;
+  }
+  for (Chunk *chunk : Draft) {
+    if (chunk != &Zero) {
+      delete chunk;
+    }
+  }
+  delete Current.load();
+}
+
+/**
+ * @brief Constructor for class Snapshot, called by Snapshot_Map::Read
+ * @param Map_ is the Snapshot_Map the Version belongs to
+ * @param Slot_ of type int stores the reader slot pinning the Version
+ * @param View_ is the pinned Version
+ */
+Snapshot_Map::Snapshot::Snapshot(const Snapshot_Map *Map_, int Slot_,
+                                 const Version *View_)
+    : Map(Map_),
+      Slot(Slot_),
+      View(View_) {
+}
+
+/**
+ * @brief Move Constructor for class Snapshot
+ * @param other_ is the handle whose Version is taken over
+ */
+Snapshot_Map::Snapshot::Snapshot(Snapshot&& other_)
+    : Map(other_.Map),
+      Slot(other_.Slot),
+      View(other_.View) {
+  other_.Slot = -1;
+  other_.View = nullptr;
+}
+
+/**
+ * @brief Is_Occupied checks the Node in the pinned Version
+ * @param coordinates_ has type Vec3i and stores the Node
+ * @return true if the Node is an Obstacle or outside the World
+ */
+bool Snapshot_Map::Snapshot::Is_Occupied(Vec3i coordinates_) const {
+  if (coordinates_.x < 0 || coordinates_.x >= Map->World_Size.x
+      || coordinates_.y < 0 || coordinates_.y >= Map->World_Size.y
+      || coordinates_.z < 0 || coordinates_.z >= Map->World_Size.z) {
+    return true;
+  }
+  std::pair<std::size_t, std::size_t> Place = Map->Locate(coordinates_);
+  return (*View->Chunks[Place.first])[Place.second] != 0;
+}
+
+/**
+ * @brief Epoch gives the epoch of the pinned Version
+ * @return epoch of type uint64_t
+ */
+uint64_t Snapshot_Map::Snapshot::Epoch() const {
+  return View->Epoch;
+}
+
+/**
+ * @brief Release unpins the Version, the handle must not be used after
+ * @return void
+ */
+void Snapshot_Map::Snapshot::Release() {
+  if (Slot >= 0) {
+    Map->Readers[Slot].store(0);
+    Slot = -1;
+    View = nullptr;
+  }
+}
+
+/** Destructor for Snapshot Class */
+Snapshot_Map::Snapshot::~Snapshot() {
+  Release();
+}
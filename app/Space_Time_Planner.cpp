@@ -0,0 +1,193 @@
+/**
+ * @file Space_Time_Planner.cpp
+ * @brief This file contains the code for Space_Time_Planner class which
+ * plans over (x, y, z, t) with A* while avoiding reserved Nodes.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* --Includes-- */
+#include <algorithm>
+#include <queue>
+#include <unordered_map>
+#include <vector>
+#include "../include/Space_Time_Planner.h"
+
+namespace {
+
+/**
+ * @brief State of type Struct is a Node at a time step reached by the search
+ */
+struct State {
+  Vec3i coordinates;  ///< Node of the State
+  int Time;  ///< Time step of the State
+  double G;  ///< Cost-to-Start value
+  int Parent;  ///< Index of the Parent State, -1 for the Start
+};
+
+/**
+ * @brief Entry of type Struct is an element of the Open List
+ */
+struct Entry {
+  double F, G;  ///< F and G values of the State
+  int Index;  ///< Index of the State
+};
+
+/**
+ * @brief Entry_Order orders the Open List by least F value, ties prefer the
+ * higher G value and then the earlier State
+ */
+struct Entry_Order {
+  bool operator()(const Entry& left_, const Entry& right_) const {
+    if (left_.F != right_.F) {
+      return left_.F > right_.F;
+    }
+    if (left_.G != right_.G) {
+      return left_.G < right_.G;
+    }
+    return left_.Index > right_.Index;
+  }
+};
+
+}  // namespace
+
+/**
+ * @brief Constructor for class Space_Time_Planner
+ * @param Plan_ is the Planner whose World, Obstacles, Directions and
+ * Heuristic are used
+ */
+Space_Time_Planner::Space_Time_Planner(const Planner& Plan_)
+    : heuristic(Plan_.heuristic),
+      direction(Plan_.direction),
+      Map(Plan_.World_Size),
+      Wait_Cost(100),
+      Max_Time(0),
+      Expanded(0) {
+  Map.Add_Obstacles(Plan_);
+}
+
+/**
+ * @brief findPath Finds the path from Start to Goal Point through space and
+ * time
+ * @param Start_ of type Vec3i struct which stores Start point coordinates
+ * @param Goal_ of type Vec3i struct which store Goal point coordinates
+ * @param Table_ of type Reservation_Table stores the Nodes held by others
+ * @param Start_Time_ of type int stores the time step of the Start
+ * @return vector of Vec3i type indexed by time step, empty if no path exists
+ */
+std::vector<Vec3i> Space_Time_Planner::findPath(Vec3i Start_, Vec3i Goal_,
+                                                const Reservation_Table& Table_,
+                                                int Start_Time_) {
+  std::vector<Vec3i> path;
+  Expanded = 0;
+  if (Map.Is_Occupied(Start_) || Map.Is_Occupied(Goal_)
+      || Start_Time_ < 0 || Start_Time_ >= Reservation_Table::Max_Time) {
+    return path;
+  }
+  /**
+   * The Start must be free when the agent stands on it. Only parked agents
+   * hold a Node after Max_Time, and a parked Goal is never free for good.
+   */
+  if (!Table_.Is_Free(Start_, Start_Time_)
+      || !Table_.Is_Free(Goal_, Reservation_Table::Max_Time + 1)) {
+    return path;
+  }
+  /** Paths have to fit the keys of the Reservation_Table */
+  int Limit = std::min(Start_Time_ + ((Max_Time > 0) ? Max_Time
+      : std::max(0, Table_.Last_Time() - Start_Time_)
+        + 4 * (Map.World_Size.x + Map.World_Size.y + Map.World_Size.z)),
+      Reservation_Table::Max_Time);
+
+  std::vector<State> States;
+  std::priority_queue<Entry, std::vector<Entry>, Entry_Order> Open;
+  /** Best maps a Node and time step to the index of its best State */
+  std::unordered_map<uint64_t, int> Best;
+  auto Key = [&](Vec3i coordinates_, int Time_) {
+    return static_cast<uint64_t>(Map.Index(coordinates_)) * (Limit + 1)
+        + static_cast<uint64_t>(Time_ - Start_Time_);
+  };
+
+  States.push_back({Start_, Start_Time_, 0, -1});
+  Best[Key(Start_, Start_Time_)] = 0;
+  Open.push({heuristic(Start_, Goal_), 0, 0});
+  int Found = -1;
+  while (!Open.empty()) {
+    Entry current = Open.top();
+    Open.pop();
+    State Now = States[current.Index];
+    if (Best[Key(Now.coordinates, Now.Time)] != current.Index) {
+      continue;  ///< Stale Entry, the State was reached cheaper since
+    }
+    /**
+     * Stop once the agent can stay on the Goal for good, never on a Goal
+     * another agent reserves at a later time step
+     */
+    if (Now.coordinates == Goal_ && Table_.Can_Park(Goal_, Now.Time)) {
+      Found = current.Index;
+      break;
+    }
+    if (Now.Time >= Limit) {
+      continue;
+    }
+    ++Expanded;
+
+    /** Wait in place or move along each direction */
+    for (std::size_t i = 0; i <= direction.size(); ++i) {
+      bool Wait = (i == direction.size());
+      Vec3i newCoordinates = Wait ? Now.coordinates
+          : Vec3i({Now.coordinates.x + direction[i].x,
+                   Now.coordinates.y + direction[i].y,
+                   Now.coordinates.z + direction[i].z});
+      if ((!Wait && Map.Is_Occupied(newCoordinates))
+          || !Table_.Can_Move(Now.coordinates, newCoordinates, Now.Time)) {
+        continue;
+      }
+      double Total_Cost = Now.G
+          + (Wait ? Wait_Cost : Planner::Step_Cost(direction[i]));
+      uint64_t Successor = Key(newCoordinates, Now.Time + 1);
+      auto found = Best.find(Successor);
+      if (found != Best.end() && States[found->second].G <= Total_Cost) {
+        continue;
+      }
+      int Index = static_cast<int>(States.size());
+      States.push_back({newCoordinates, Now.Time + 1, Total_Cost,
+        current.Index});
+      Best[Successor] = Index;
+      Open.push({Total_Cost + heuristic(newCoordinates, Goal_), Total_Cost,
+        Index});
+    }
+  }
+
+  /** Store Path from Start to Goal in path vector */
+  for (int Index = Found; Index >= 0; Index = States[Index].Parent) {
+    path.push_back(States[Index].coordinates);
+  }
+  std::reverse(path.begin(), path.end());
+  return path;  ///< Return Calculated path
+}
+
+/** Destructor for Space_Time_Planner Class */
+Space_Time_Planner::~Space_Time_Planner() {
+}
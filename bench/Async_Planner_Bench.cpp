@@ -0,0 +1,95 @@
+/**
+ * @file Async_Planner_Bench.cpp
+ * @brief Benchmark of Async_Planner. Measures how long a controller waits
+ * for the first waypoint, the greedy path and the committed path compared
+ * with a synchronous Integer_Planner search.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/** --Includes--*/
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "Bench.h"
+#include "../include/Async_Planner.h"
+#include "../include/Integer_Planner.h"
+
+/**
+ * @brief Async_Planner_Bench plans one query on benchmark worlds of growing
+ * size, synchronously and through Async_Planner, and prints the seconds
+ * until the greedy path, until the first committed waypoint, until half of
+ * the final path is committed and until the query ends. The first waypoint
+ * is the second Node of the greedy path.
+ * @param argc is an integer, options are [max size] [commit interval]
+ * @param argv is a pointer to a pointer to a character.
+ * @return 0 if the asynchronous path equals the synchronous one
+ */
+int Async_Planner_Bench(int argc, char **argv) {
+  int Max_Size = (argc > 1) ? std::atoi(argv[1]) : 64;
+  int Interval = (argc > 2) ? std::atoi(argv[2]) : 1024;
+  int Result = 0;
+  std::cout << "async: latency to the first waypoint\n"
+      << "world\t\tsync\tgreedy\tfirst\thalf\tfull\t"
+      << "greedy cost\tcost\n";
+  for (int Size = 16; Size <= Max_Size; Size *= 2) {
+    Vec3i World_Size = { Size, Size, Size / 2 };
+    Planner Plan = Benchmark_World(World_Size, 2);
+    Vec3i Goal = { Size - 1, Size - 1, Size / 2 - 1 };
+    Integer_Planner Search(Plan);
+    std::vector<Vec3i> Expected;
+    double Sync = Time_Seconds([&]() {
+      Expected = Search.findPath({ 0, 0, 0 }, Goal);
+    });
+    std::reverse(Expected.begin(), Expected.end());
+
+    Async_Planner Async(Plan);
+    Async.Commit_Interval = std::max(1, Interval);
+    auto Begin = std::chrono::steady_clock::now();
+    auto Since = [&]() {
+      return std::chrono::duration<double>(
+          std::chrono::steady_clock::now() - Begin).count();
+    };
+    auto Query = Async.Submit({ 0, 0, 0 }, Goal);
+    int Lower = 0, Upper = 0;
+    Query->Wait_Best(&Lower, &Upper);
+    double Greedy = Since();
+    Query->Wait_Committed(2);
+    double First = Since();
+    Query->Wait_Committed(Expected.size() / 2);
+    double Half = Since();
+    std::vector<Vec3i> path = Query->Wait();
+    double Full = Since();
+    if (path.empty() || path != Expected) {
+      Result = 1;
+    }
+    std::cout << World_Size.x << "x" << World_Size.y << "x" << World_Size.z
+        << "\t" << Sync << "\t" << Greedy << "\t" << First << "\t" << Half
+        << "\t" << Full << "\t" << Upper << "\t\t" << Search.Cost << "\n";
+  }
+  return Result;
+}
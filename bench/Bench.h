@@ -0,0 +1,88 @@
+/**
+ * @file Bench.h
+ * @brief This file contains the declarations shared by the benchmarks of the
+ * planners: the benchmark worlds, a timer and one entry point per benchmark.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MID_TERM_A_STAR_3D_BENCH_BENCH_H_
+#define MID_TERM_A_STAR_3D_BENCH_BENCH_H_
+
+/* --Includes-- */
+#include <functional>
+#include "../include/Planner.h"
+
+/**
+ * @brief Benchmark_World builds a Planner over a world split by walls
+ * perpendicular to x. Each wall has one window which alternates between
+ * opposite corners, so the path has to zig-zag through the whole world.
+ * @param World_Size_ of type Vec3i struct stores the World Dimensions
+ * @param Walls_ of type int stores the number of walls
+ * @return Planner with the Obstacles of the world and Octile heuristic
+ */
+Planner Benchmark_World(Vec3i World_Size_, int Walls_);
+
+/**
+ * @brief Time_Seconds measures the wall clock time of a function
+ * @param Function_ is the function to measure
+ * @return time in seconds
+ */
+double Time_Seconds(const std::function<void()>& Function_);
+
+/** Parallel_Planner_Bench measures strong scaling of Parallel_Planner */
+int Parallel_Planner_Bench(int argc, char **argv);
+
+/** Grid_Geometry_Bench measures point conversion throughput */
+int Grid_Geometry_Bench(int argc, char **argv);
+
+/** Point_Cloud_Ingest_Bench measures points per second of ingestion */
+int Point_Cloud_Ingest_Bench(int argc, char **argv);
+
+/** Prioritized_Planner_Bench measures fleet planning throughput */
+int Prioritized_Planner_Bench(int argc, char **argv);
+
+/** Lazy_Collision_Bench measures collision checks saved by findPath modes */
+int Lazy_Collision_Bench(int argc, char **argv);
+
+/** Goal_Bounding_Bench measures preprocessing, size and pruned queries */
+int Goal_Bounding_Bench(int argc, char **argv);
+
+/** Multi_Resolution_Bench measures coarse to fine latency and cost gap */
+int Multi_Resolution_Bench(int argc, char **argv);
+
+/** Snapshot_Map_Bench measures mixed read and write throughput */
+int Snapshot_Map_Bench(int argc, char **argv);
+
+/** Integer_Planner_Bench measures the bucket queue search */
+int Integer_Planner_Bench(int argc, char **argv);
+
+/** Async_Planner_Bench measures latency to the first waypoint */
+int Async_Planner_Bench(int argc, char **argv);
+
+/** Passability_Map_Bench measures corner cutting free neighbor expansion */
+int Passability_Map_Bench(int argc, char **argv);
+
+#endif  // MID_TERM_A_STAR_3D_BENCH_BENCH_H_
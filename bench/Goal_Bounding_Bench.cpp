@@ -0,0 +1,81 @@
+/**
+ * @file Goal_Bounding_Bench.cpp
+ * @brief Benchmark of Goal_Bounding. Measures the preprocessing time, the
+ * size of the table before and after palette compression and the speedup of
+ * pruned queries on the benchmark worlds.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/** --Includes--*/
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <vector>
+#include "Bench.h"
+#include "../include/Goal_Bounding.h"
+
+/**
+ * @brief Goal_Bounding_Bench builds the table for benchmark worlds of
+ * growing size and plans the same query with and without it. Preprocessing
+ * floods the map from every Node, so the worlds are kept small.
+ * @param argc is an integer, options are [max size] [threads]
+ * @param argv is a pointer to a pointer to a character.
+ * @return 0 if the pruned queries found paths of the same cost
+ */
+int Goal_Bounding_Bench(int argc, char **argv) {
+  int Max_Size = (argc > 1) ? std::atoi(argv[1]) : 16;
+  int Threads = (argc > 2) ? std::atoi(argv[2]) : 0;
+  int Result = 0;
+  std::cout << "bounding: Goal_Bounding preprocessing and queries\n"
+      << "world\t\tbuild s\traw KB\tKB\tboxes\tfull s\tpruned s\tspeedup"
+      << "\tchecks\tpruned checks\n";
+  for (int Size = 12; Size <= Max_Size; Size += 4) {
+    Vec3i World_Size = { Size, Size, Size / 2 };
+    Planner Plan = Benchmark_World(World_Size, 2);
+    auto Table = std::make_shared<Goal_Bounding>();
+    double Build_Time = Time_Seconds([&]() { Table->Build(Plan, Threads); });
+    Vec3i Goal = { Size - 1, Size - 1, Size / 2 - 1 };
+    std::vector<Vec3i> Full_Path, Pruned_Path;
+    double Full_Time = Time_Seconds([&]() {
+      Full_Path = Plan.findPath({ 0, 0, 0 }, Goal);
+    });
+    std::size_t Full_Checks = Plan.Collision_Checks;
+    Plan.Set_Goal_Bounding(Table);
+    double Pruned_Time = Time_Seconds([&]() {
+      Pruned_Path = Plan.findPath({ 0, 0, 0 }, Goal);
+    });
+    if (Planner::Path_Cost(Pruned_Path) != Planner::Path_Cost(Full_Path)) {
+      Result = 1;
+    }
+    std::cout << World_Size.x << "x" << World_Size.y << "x" << World_Size.z
+        << "\t" << Build_Time << "\t" << Table->Raw_Bytes() / 1024 << "\t"
+        << Table->Bytes() / 1024 << "\t" << Table->Palette_Size << "\t"
+        << Full_Time << "\t" << Pruned_Time << "\t\t"
+        << Full_Time / Pruned_Time << "\t" << Full_Checks << "\t"
+        << Plan.Collision_Checks << "\n";
+  }
+  return Result;
+}
@@ -0,0 +1,89 @@
+/**
+ * @file Grid_Geometry_Bench.cpp
+ * @brief Throughput benchmark of the point conversions: the vector API of
+ * Build_Map against the value and batched SIMD API of Grid_Geometry.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/** --Includes--*/
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "Bench.h"
+#include "../include/Build_Map.h"
+
+/**
+ * @brief Grid_Geometry_Bench converts the same random points to Nodes with
+ * Build_Map::Build_Node, Grid_Geometry::To_Cell and Grid_Geometry::To_Cells
+ * and prints millions of points per second for each.
+ * @param argc is an integer, options are [points]
+ * @param argv is a pointer to a pointer to a character.
+ * @return 0 if all conversions agree
+ */
+int Grid_Geometry_Bench(int argc, char **argv) {
+  std::size_t Count = (argc > 1) ? std::atol(argv[1]) : 4000000;
+  Build_Map Map = Build_Map({ 0.0, -5.0, 0.0, 10.0, 20.0, 6.0 }, 0.25, 0.25,
+                            0.2);
+  std::mt19937 Generator(3);
+  std::uniform_real_distribution<double> Uniform(0.0, 1.0);
+  std::vector<Vec3d> Points(Count);
+  for (auto& point : Points) {
+    point = {10.0 * Uniform(Generator), -5.0 + 25.0 * Uniform(Generator),
+             6.0 * Uniform(Generator)};
+  }
+  std::vector<Vec3i> Vector_Cells(Count), Value_Cells(Count),
+      Batched_Cells(Count);
+
+  double Vector_Time = Time_Seconds([&]() {
+    for (std::size_t i = 0; i < Count; ++i) {
+      std::vector<int> Node = Map.Build_Node({ Points[i].x, Points[i].y,
+          Points[i].z });
+      Vector_Cells[i] = { Node[0], Node[1], Node[2] };
+    }
+  });
+  double Value_Time = Time_Seconds([&]() {
+    for (std::size_t i = 0; i < Count; ++i) {
+      Value_Cells[i] = Map.Geometry.To_Cell(Points[i]);
+    }
+  });
+  double Batched_Time = Time_Seconds([&]() {
+    Map.Geometry.To_Cells(Points.data(), Count, Batched_Cells.data());
+  });
+
+  int Result = 0;
+  for (std::size_t i = 0; i < Count; ++i) {
+    if (!(Vector_Cells[i] == Value_Cells[i])
+        || !(Value_Cells[i] == Batched_Cells[i])) {
+      Result = 1;
+    }
+  }
+  std::cout << "geometry: " << Count << " points, million points/s\n"
+      << "Build_Node\t" << Count / Vector_Time / 1e6 << "\n"
+      << "To_Cell\t\t" << Count / Value_Time / 1e6 << "\n"
+      << "To_Cells\t" << Count / Batched_Time / 1e6 << "\n";
+  return Result;
+}
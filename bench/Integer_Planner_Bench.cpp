@@ -0,0 +1,101 @@
+/**
+ * @file Integer_Planner_Bench.cpp
+ * @brief Benchmark of Integer_Planner. Compares the bucket queue search
+ * with a binary heap search and Planner::findPath and checks that repeated
+ * runs expand the same Nodes.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/** --Includes--*/
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "Bench.h"
+#include "../include/Integer_Planner.h"
+#include "../include/Multi_Resolution_Planner.h"
+
+/**
+ * @brief Integer_Planner_Bench plans the same query three times with each
+ * search on benchmark worlds of growing size and prints the best time, the
+ * expanded Nodes and whether every run returned the same path.
+ * Multi_Resolution_Planner without coarse levels is the binary heap search.
+ * @param argc is an integer, options are [max size] [findPath max size]
+ * @param argv is a pointer to a pointer to a character.
+ * @return 0 if every search found a path of the same cost every run
+ */
+int Integer_Planner_Bench(int argc, char **argv) {
+  int Max_Size = (argc > 1) ? std::atoi(argv[1]) : 64;
+  int Max_Find_Size = (argc > 2) ? std::atoi(argv[2]) : 16;
+  int Result = 0;
+  std::cout << "integer: integer cost search\n"
+      << "world\t\tsearch\t\tseconds\texpanded\tcost\tidentical runs\n";
+  for (int Size = 16; Size <= Max_Size; Size *= 2) {
+    Vec3i World_Size = { Size, Size, Size / 2 };
+    Planner Plan = Benchmark_World(World_Size, 2);
+    Integer_Planner Search(Plan);
+    Multi_Resolution_Planner Heap(Plan, 1);
+    Heap.Coarse_Level = 0;
+    Vec3i Goal = { Size - 1, Size - 1, Size / 2 - 1 };
+    double Reference_Cost = -1;
+    for (int Mode = (Size <= Max_Find_Size) ? 0 : 1; Mode < 3; ++Mode) {
+      std::vector<Vec3i> First_Path;
+      double Best = 1e9;
+      std::size_t Expanded = 0;
+      bool Identical = true;
+      for (int Run = 0; Run < 3; ++Run) {
+        std::vector<Vec3i> path;
+        double Time = Time_Seconds([&]() {
+          path = (Mode == 0) ? Plan.findPath({ 0, 0, 0 }, Goal)
+              : (Mode == 1) ? Heap.findPath({ 0, 0, 0 }, Goal)
+              : Search.findPath({ 0, 0, 0 }, Goal);
+        });
+        Best = std::min(Best, Time);
+        Expanded = (Mode == 1) ? Heap.Expanded
+            : (Mode == 2) ? Search.Expanded : 0;
+        if (Run == 0) {
+          First_Path = path;
+        } else {
+          Identical = Identical && path == First_Path;
+        }
+      }
+      double Cost = Planner::Path_Cost(First_Path);
+      if (Reference_Cost < 0) {
+        Reference_Cost = Cost;
+      }
+      if (First_Path.empty() || Cost != Reference_Cost || !Identical) {
+        Result = 1;
+      }
+      const char *Names[3] = { "findPath\t", "binary heap\t",
+        "bucket queue\t" };
+      std::cout << World_Size.x << "x" << World_Size.y << "x" << World_Size.z
+          << "\t" << Names[Mode] << Best << "\t"
+          << (Mode == 0 ? std::string("-") : std::to_string(Expanded)) << "\t\t"
+          << Cost << "\t" << (Identical ? "yes" : "no") << "\n";
+    }
+  }
+  return Result;
+}
@@ -0,0 +1,79 @@
+/**
+ * @file Lazy_Collision_Bench.cpp
+ * @brief Benchmark of the collision check modes of Planner::findPath. Counts
+ * the collision checks saved by Lazy A* and the per query memo bitmap on the
+ * benchmark worlds.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/** --Includes--*/
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "Bench.h"
+
+/**
+ * @brief Lazy_Collision_Bench plans the same query with each collision check
+ * mode on benchmark worlds of growing size and prints checks, checks saved
+ * against the eager mode, time and path cost.
+ * @param argc is an integer, options are [max size]
+ * @param argv is a pointer to a pointer to a character.
+ * @return 0 if every mode found a path of the same cost
+ */
+int Lazy_Collision_Bench(int argc, char **argv) {
+  int Max_Size = (argc > 1) ? std::atoi(argv[1]) : 24;
+  int Result = 0;
+  std::cout << "lazy: Planner::findPath collision checks\n"
+      << "world\t\tmode\t\tchecks\tsaved %\tseconds\tcost\n";
+  for (int Size = 12; Size <= Max_Size; Size += 6) {
+    Vec3i World_Size = { Size, Size, Size / 2 };
+    Planner Plan = Benchmark_World(World_Size, 2);
+    Vec3i Goal = { Size - 1, Size - 1, Size / 2 - 1 };
+    double Eager_Checks = 0, Eager_Cost = 0;
+    for (int Mode = 0; Mode < 4; ++Mode) {
+      bool Lazy = (Mode & 2) != 0, Memo = (Mode & 1) != 0;
+      Plan.Set_Lazy_Collision(Lazy);
+      Plan.Set_Collision_Memo(Memo);
+      std::vector<Vec3i> path;
+      double Time = Time_Seconds([&]() {
+        path = Plan.findPath({ 0, 0, 0 }, Goal);
+      });
+      double Cost = Planner::Path_Cost(path);
+      if (Mode == 0) {
+        Eager_Checks = static_cast<double>(Plan.Collision_Checks);
+        Eager_Cost = Cost;
+      } else if (Cost != Eager_Cost) {
+        Result = 1;
+      }
+      const char *Names[4] = { "eager\t", "memo\t", "lazy\t", "lazy+memo" };
+      std::cout << World_Size.x << "x" << World_Size.y << "x" << World_Size.z
+          << "\t" << Names[Mode] << "\t" << Plan.Collision_Checks << "\t"
+          << 100.0 * (1.0 - Plan.Collision_Checks / Eager_Checks) << "\t"
+          << Time << "\t" << Cost << "\n";
+    }
+  }
+  return Result;
+}
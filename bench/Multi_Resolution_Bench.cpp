@@ -0,0 +1,99 @@
+/**
+ * @file Multi_Resolution_Bench.cpp
+ * @brief Benchmark of Multi_Resolution_Planner. Measures the latency and
+ * the optimality gap of coarse to fine planning against full resolution
+ * search on the benchmark worlds.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/** --Includes--*/
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "Bench.h"
+#include "../include/Multi_Resolution_Planner.h"
+
+/**
+ * @brief Multi_Resolution_Bench plans the same query on benchmark worlds of
+ * growing size with Planner::findPath (on the small worlds only, it scales
+ * quadratically), with a full resolution search and with each coarse level,
+ * and prints time, speedup over the full resolution search and the gap to
+ * the optimal path cost.
+ * @param argc is an integer, options are [max size] [findPath max size]
+ * @param argv is a pointer to a pointer to a character.
+ * @return 0 if every search found a path
+ */
+int Multi_Resolution_Bench(int argc, char **argv) {
+  int Max_Size = (argc > 1) ? std::atoi(argv[1]) : 64;
+  int Max_Find_Size = (argc > 2) ? std::atoi(argv[2]) : 16;
+  int Result = 0;
+  std::cout << "multires: coarse to fine planning\n"
+      << "world\t\tsearch\t\tlevel\tused\tseconds\tspeedup\texpanded\tgap %\n";
+  for (int Size = 16; Size <= Max_Size; Size *= 2) {
+    Vec3i World_Size = { Size, Size, Size / 2 };
+    Planner Plan = Benchmark_World(World_Size, 2);
+    Multi_Resolution_Planner Multi(Plan);
+    Vec3i Goal = { Size - 1, Size - 1, Size / 2 - 1 };
+    auto Print = [&](const char *Name_, int Level_, int Used_, double Time_,
+                     double Full_Time_, std::size_t Expanded_, double Gap_) {
+      std::cout << World_Size.x << "x" << World_Size.y << "x" << World_Size.z
+          << "\t" << Name_ << "\t" << Level_ << "\t" << Used_ << "\t" << Time_
+          << "\t" << Full_Time_ / Time_ << "\t" << Expanded_ << "\t\t" << Gap_
+          << "\n";
+    };
+
+    std::vector<Vec3i> path;
+    Multi.Coarse_Level = 0;
+    double Full_Time = Time_Seconds([&]() {
+      path = Multi.findPath({ 0, 0, 0 }, Goal);
+    });
+    double Optimal = Planner::Path_Cost(path);
+    if (path.empty()) {
+      Result = 1;
+    }
+    if (Size <= Max_Find_Size) {
+      double Time = Time_Seconds([&]() {
+        path = Plan.findPath({ 0, 0, 0 }, Goal);
+      });
+      Print("findPath\t", 0, 0, Time, Full_Time, 0,
+            100.0 * (Planner::Path_Cost(path) / Optimal - 1.0));
+    }
+    Print("full\t", 0, 0, Full_Time, Full_Time, Multi.Expanded, 0.0);
+    for (int Level = 1; Level < static_cast<int>(Multi.Levels.size());
+        ++Level) {
+      Multi.Coarse_Level = Level;
+      double Time = Time_Seconds([&]() {
+        path = Multi.findPath({ 0, 0, 0 }, Goal);
+      });
+      if (path.empty()) {
+        Result = 1;
+      }
+      Print("coarse to fine", Level, Multi.Used_Level, Time, Full_Time,
+            Multi.Expanded, 100.0 * (Planner::Path_Cost(path) / Optimal - 1.0));
+    }
+  }
+  return Result;
+}
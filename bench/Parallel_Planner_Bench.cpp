@@ -0,0 +1,96 @@
+/**
+ * @file Parallel_Planner_Bench.cpp
+ * @brief Strong scaling benchmark of Parallel_Planner. A single long query
+ * on a large benchmark world is planned with 1 to 32 threads.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/** --Includes--*/
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "Bench.h"
+#include "../include/Parallel_Planner.h"
+
+/**
+ * @brief Parallel_Planner_Bench plans one query across a benchmark world
+ * with a growing number of threads and prints time, speedup and path cost.
+ * A small world is also planned with Planner::findPath to check the costs.
+ * @param argc is an integer, options are [size] [max threads]
+ * @param argv is a pointer to a pointer to a character.
+ * @return 0 if every path cost matched
+ */
+int Parallel_Planner_Bench(int argc, char **argv) {
+  int Size = (argc > 1) ? std::atoi(argv[1]) : 128;
+  int Max_Threads = (argc > 2) ? std::atoi(argv[2]) : 32;
+  int Result = 0;
+
+  /** Check against the serial planner on a world it can handle quickly */
+  Planner Small = Benchmark_World({ 16, 16, 8 }, 2);
+  std::vector<Vec3i> Serial_Path;
+  double Serial_Time = Time_Seconds([&]() {
+    Serial_Path = Small.findPath({ 0, 0, 0 }, { 15, 15, 7 });
+  });
+  Parallel_Planner Small_Parallel(Small);
+  std::vector<Vec3i> Parallel_Path;
+  double Parallel_Time = Time_Seconds([&]() {
+    Parallel_Path = Small_Parallel.findPath({ 0, 0, 0 }, { 15, 15, 7 }, 4);
+  });
+  std::cout << "parallel: 16x16x8 world, Planner::findPath cost "
+      << Planner::Path_Cost(Serial_Path) << " in " << Serial_Time
+      << " s, Parallel_Planner cost " << Planner::Path_Cost(Parallel_Path)
+      << " in " << Parallel_Time << " s\n";
+  if (Planner::Path_Cost(Serial_Path) != Planner::Path_Cost(Parallel_Path)) {
+    Result = 1;
+  }
+
+  /** Strong scaling on one long query */
+  Vec3i World_Size = { Size, Size, Size / 2 };
+  Vec3i Goal = { World_Size.x - 1, World_Size.y - 1, World_Size.z - 1 };
+  Parallel_Planner Plan(Benchmark_World(World_Size, 6));
+  std::cout << "parallel: " << World_Size.x << "x" << World_Size.y << "x"
+      << World_Size.z << " world, hardware threads "
+      << std::thread::hardware_concurrency() << "\n"
+      << "threads\tseconds\tspeedup\texpanded\tmessages\tcost\n";
+  double Base_Time = 0, Base_Cost = 0;
+  for (int Threads = 1; Threads <= Max_Threads; Threads *= 2) {
+    std::vector<Vec3i> path;
+    double Time = Time_Seconds([&]() {
+      path = Plan.findPath({ 0, 0, 0 }, Goal, Threads);
+    });
+    double Cost = Planner::Path_Cost(path);
+    if (Threads == 1) {
+      Base_Time = Time;
+      Base_Cost = Cost;
+    } else if (Cost != Base_Cost) {
+      Result = 1;
+    }
+    std::cout << Threads << "\t" << Time << "\t" << Base_Time / Time << "\t"
+        << Plan.Expanded << "\t" << Plan.Messages << "\t" << Cost << "\n";
+  }
+  return Result;
+}
@@ -0,0 +1,159 @@
+/**
+ * @file Passability_Map_Bench.cpp
+ * @brief Benchmark of Passability_Map. Compares neighbor expansion over
+ * the precomputed masks with collision checks of each neighbor, with and
+ * without checking the Nodes a diagonal move sweeps.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/** --Includes--*/
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <vector>
+#include "Bench.h"
+#include "../include/Occupancy_Map.h"
+#include "../include/Passability_Map.h"
+
+/**
+ * @brief Passability_Map_Bench builds the masks of benchmark worlds with
+ * scattered Obstacles and expands every free Node three ways: looking up
+ * each neighbor in the Occupancy_Map, checking every Node each move
+ * sweeps, and iterating the mask bits. It prints the build time, the
+ * expansions per second of each way, the time of one mask update by
+ * Add_Collision or Clear and, for small worlds, findPath with collision
+ * checks and with masks.
+ * @param argc is an integer, options are [max size] [threads]
+ * [findPath max size]
+ * @param argv is a pointer to a pointer to a character.
+ * @return 0 if the swept checks and the masks agree on every neighbor
+ */
+int Passability_Map_Bench(int argc, char **argv) {
+  int Max_Size = (argc > 1) ? std::atoi(argv[1]) : 64;
+  int Threads = (argc > 2) ? std::atoi(argv[2]) : 0;
+  int Max_Find_Size = (argc > 3) ? std::atoi(argv[3]) : 16;
+  int Result = 0;
+  std::cout << "passability: corner cutting free neighbor expansion\n"
+      << "world\t\tbuild s\tMexp/s map\tMexp/s swept\tMexp/s mask"
+      << "\tupdate us\tfindPath s\tmask findPath s\n";
+  for (int Size = 16; Size <= Max_Size; Size *= 2) {
+    Vec3i World_Size = { Size, Size, Size / 2 };
+    Planner Plan = Benchmark_World(World_Size, 2);
+    std::srand(1);
+    std::size_t Scattered = static_cast<std::size_t>(Size) * Size * Size / 80;
+    for (std::size_t Obstacle = 0; Obstacle < Scattered; ++Obstacle) {
+      Plan.Add_Collision({ 1 + std::rand() % (Size - 2),
+        1 + std::rand() % (Size - 2), std::rand() % (Size / 2) });
+    }
+    std::shared_ptr<Passability_Map> Masks;
+    double Build_Time = Time_Seconds([&]() {
+      Masks = std::make_shared<Passability_Map>(Plan, Threads);
+    });
+    const Occupancy_Map& Map = Masks->Map;
+    std::vector<std::size_t> Free;
+    for (std::size_t Cell = 0; Cell < Map.Size(); ++Cell) {
+      if (Map.Cells[Cell] == 0) {
+        Free.push_back(Cell);
+      }
+    }
+
+    /** Each way counts the neighbors it keeps so none is optimized away */
+    std::size_t Counts[3] = { 0, 0, 0 };
+    double Times[3];
+    /** Destinations only, without the walls scan of Detect_Collision */
+    Times[0] = Time_Seconds([&]() {
+      for (std::size_t Cell : Free) {
+        Vec3i At = Map.Coordinates(Cell);
+        for (const Vec3i& move : Plan.direction) {
+          Counts[0] += !Map.Is_Occupied({ At.x + move.x, At.y + move.y,
+            At.z + move.z });
+        }
+      }
+    });
+    Times[1] = Time_Seconds([&]() {
+      for (std::size_t Cell : Free) {
+        Vec3i At = Map.Coordinates(Cell);
+        for (const Vec3i& move : Plan.direction) {
+          bool Passable = true;
+          for (int Axes = 1; Axes < 8 && Passable; ++Axes) {
+            Passable = !Map.Is_Occupied({ At.x + ((Axes & 1) ? move.x : 0),
+              At.y + ((Axes & 2) ? move.y : 0),
+              At.z + ((Axes & 4) ? move.z : 0) });
+          }
+          Counts[1] += Passable;
+        }
+      }
+    });
+    Times[2] = Time_Seconds([&]() {
+      for (std::size_t Cell : Free) {
+        for (uint32_t Moves = Masks->Masks[Cell]; Moves != 0;
+            Moves &= Moves - 1) {
+          Counts[2] += Passability_Map::Lowest_Move(Moves) < 26;
+        }
+      }
+    });
+    if (Counts[1] != Counts[2]) {
+      Result = 1;
+    }
+
+    /** Add Obstacles at free Nodes through the Planner and remove them */
+    Plan.Set_Passability(Masks);
+    const int Updates = 1000;
+    std::vector<Vec3i> Changed;
+    for (int Update = 0; Update < Updates; ++Update) {
+      Changed.push_back(Map.Coordinates(Free[std::rand() % Free.size()]));
+    }
+    double Update_Time = Time_Seconds([&]() {
+      for (const Vec3i& At : Changed) {
+        Plan.Add_Collision(At);
+        Masks->Clear(At);
+      }
+    });
+    Plan.walls.resize(Plan.walls.size() - Updates);
+
+    double Find_Time = 0, Mask_Find_Time = 0;
+    if (Size <= Max_Find_Size) {
+      Vec3i Goal = { Size - 1, Size - 1, Size / 2 - 1 };
+      Plan.Set_Passability(nullptr);
+      Find_Time = Time_Seconds([&]() { Plan.findPath({ 0, 0, 0 }, Goal); });
+      Plan.Set_Passability(Masks);
+      Mask_Find_Time = Time_Seconds([&]() {
+        Plan.findPath({ 0, 0, 0 }, Goal);
+      });
+    }
+    double Expansions = static_cast<double>(Free.size()) / 1e6;
+    std::cout << World_Size.x << "x" << World_Size.y << "x" << World_Size.z
+        << "\t" << Build_Time << "\t" << Expansions / Times[0] << "\t\t"
+        << Expansions / Times[1] << "\t\t" << Expansions / Times[2] << "\t\t"
+        << Update_Time / (2 * Updates) * 1e6 << "\t\t";
+    if (Size <= Max_Find_Size) {
+      std::cout << Find_Time << "\t" << Mask_Find_Time << "\n";
+    } else {
+      std::cout << "-\t\t-\n";
+    }
+  }
+  return Result;
+}
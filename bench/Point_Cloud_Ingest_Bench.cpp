@@ -0,0 +1,129 @@
+/**
+ * @file Point_Cloud_Ingest_Bench.cpp
+ * @brief Throughput benchmark of Point_Cloud_Ingest. Synthetic LiDAR scans
+ * of a walled room are ingested with and without free space clearing while
+ * a planner thread keeps reading Snapshots.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/** --Includes--*/
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+#include "Bench.h"
+#include "../include/Point_Cloud_Ingest.h"
+
+/**
+ * @brief Scan builds one LiDAR scan from the center of a 40x40x8 room. Each
+ * beam hits the room walls, floor or ceiling, a few hit random clutter.
+ * @param Generator_ is the random number generator
+ * @param Count_ is the number of points
+ * @return points of the scan
+ */
+static std::vector<Vec3d> Scan(std::mt19937 *Generator_, std::size_t Count_) {
+  std::uniform_real_distribution<double> Angle(0.0, 2 * M_PI);
+  std::uniform_real_distribution<double> Elevation(-0.4, 0.4);
+  std::uniform_real_distribution<double> Uniform(0.0, 1.0);
+  std::vector<Vec3d> Points(Count_);
+  for (auto& point : Points) {
+    double Yaw = Angle(*Generator_), Pitch = Elevation(*Generator_);
+    Vec3d Ray = {std::cos(Yaw) * std::cos(Pitch),
+                 std::sin(Yaw) * std::cos(Pitch), std::sin(Pitch)};
+    /** Distance to the first face of the room along the ray */
+    double Range = 1e9;
+    Range = std::min(Range, 19.99 / std::max(std::abs(Ray.x), 1e-9));
+    Range = std::min(Range, 19.99 / std::max(std::abs(Ray.y), 1e-9));
+    Range = std::min(Range, 3.99 / std::max(std::abs(Ray.z), 1e-9));
+    if (Uniform(*Generator_) < 0.1) {
+      Range *= Uniform(*Generator_);  ///< Clutter inside the room
+    }
+    point = {20 + Range * Ray.x, 20 + Range * Ray.y, 4 + Range * Ray.z};
+  }
+  return Points;
+}
+
+/**
+ * @brief Point_Cloud_Ingest_Bench prints the points per second of the
+ * ingest stage alone and of the threaded pipeline
+ * @param argc is an integer, options are [points per scan] [scans]
+ * @param argv is a pointer to a pointer to a character.
+ * @return 0
+ */
+int Point_Cloud_Ingest_Bench(int argc, char **argv) {
+  std::size_t Count = (argc > 1) ? std::atol(argv[1]) : 100000;
+  int Scans = (argc > 2) ? std::atoi(argv[2]) : 20;
+  Grid_Geometry Geometry({{0.0, 0.0, 0.0}, {40.0, 40.0, 8.0}}, 0.1, 0.1, 0);
+  std::mt19937 Generator(11);
+  std::vector<std::vector<Vec3d>> Data;
+  for (int i = 0; i < Scans; ++i) {
+    Data.push_back(Scan(&Generator, Count));
+  }
+  Vec3d Origin = {20, 20, 4};
+  std::cout << "ingest: " << Scans << " scans of " << Count << " points, "
+      << Geometry.World.x << "x" << Geometry.World.y << "x"
+      << Geometry.World.z << " map\nmode\t\tmillion points/s\n";
+
+  for (bool Clear : { false, true }) {
+    /** Ingest stage alone on the calling thread */
+    Point_Cloud_Ingest Ingest(Geometry, Clear);
+    Occupancy_Map Map(Geometry.World);
+    double Time = Time_Seconds([&]() {
+      for (auto& points : Data) {
+        Ingest.Apply(points, Origin, Map);
+      }
+    });
+    std::cout << (Clear ? "apply+clear\t" : "apply\t\t")
+        << Count * Scans / Time / 1e6 << "\n";
+
+    /** Threaded pipeline while a planner thread reads Snapshots */
+    std::atomic<bool> Reading(true);
+    std::atomic<long> Reads(0), Occupied(0);
+    std::thread Reader([&]() {
+      while (Reading) {
+        auto Snapshot = Ingest.Snapshot();
+        Occupied += Snapshot->Is_Occupied({ 0, 0, 40 });
+        ++Reads;
+      }
+    });
+    Time = Time_Seconds([&]() {
+      for (auto& points : Data) {
+        Ingest.Push(points, Origin);
+      }
+      Ingest.Flush();
+    });
+    Reading = false;
+    Reader.join();
+    std::cout << (Clear ? "pipeline+clear\t" : "pipeline\t")
+        << (Count * Scans - Ingest.Dropped * Count) / Time / 1e6
+        << "\t(dropped " << Ingest.Dropped << " scans, " << Reads
+        << " snapshot reads)\n";
+  }
+  return 0;
+}
@@ -0,0 +1,123 @@
+/**
+ * @file Prioritized_Planner_Bench.cpp
+ * @brief Throughput benchmark of Prioritized_Planner and Reservation_Table as
+ * the number of robots of a fleet grows.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/** --Includes--*/
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <set>
+#include <vector>
+#include "Bench.h"
+#include "../include/Prioritized_Planner.h"
+
+/**
+ * @brief Prioritized_Planner_Bench plans fleets of growing size across an
+ * open 64x64x8 world with pillars. Each robot travels up to 24 Nodes. It
+ * prints robots planned per second, the reservation table size and lookup
+ * throughput.
+ * @param argc is an integer, options are [max robots]
+ * @param argv is a pointer to a pointer to a character.
+ * @return 0
+ */
+int Prioritized_Planner_Bench(int argc, char **argv) {
+  int Max_Robots = (argc > 1) ? std::atoi(argv[1]) : 2048;
+  Vec3i World_Size = { 64, 64, 8 };
+  Planner Plan = Planner(World_Size);
+  Plan.Set_Heuristic(Planner::Octile);
+  for (int Counter_X = 4; Counter_X < World_Size.x; Counter_X += 8) {
+    for (int Counter_Y = 4; Counter_Y < World_Size.y; Counter_Y += 8) {
+      for (int Counter_Z = 0; Counter_Z < World_Size.z; ++Counter_Z) {
+        Plan.Add_Collision({ Counter_X, Counter_Y, Counter_Z });
+      }
+    }
+  }
+  Prioritized_Planner Fleet(Plan);
+
+  std::cout << "fleet: 64x64x8 world\nrobots\tseconds\trobots/s\tfailed"
+      << "\texpanded/robot\tentries\ttable KiB\tlookups/s\n";
+  for (int Robots = 16; Robots <= Max_Robots; Robots *= 4) {
+    /** Distinct Starts and Goals, each Goal near its Start */
+    std::mt19937 Generator(Robots);
+    std::uniform_int_distribution<int> X(0, World_Size.x - 1),
+        Y(0, World_Size.y - 1), Z(0, World_Size.z - 1), Offset(-12, 12);
+    std::set<std::size_t> Used_Starts, Used_Goals;
+    std::vector<Vec3i> Starts, Goals;
+    while (static_cast<int>(Starts.size()) < Robots) {
+      Vec3i Start = { X(Generator), Y(Generator), Z(Generator) };
+      Vec3i Goal = {
+        std::min(std::max(Start.x + Offset(Generator), 0), World_Size.x - 1),
+        std::min(std::max(Start.y + Offset(Generator), 0), World_Size.y - 1),
+        Z(Generator) };
+      if (Fleet.Single.Map.Is_Occupied(Start)
+          || Fleet.Single.Map.Is_Occupied(Goal)
+          || !Used_Starts.insert(Fleet.Single.Map.Index(Start)).second) {
+        continue;
+      }
+      if (!Used_Goals.insert(Fleet.Single.Map.Index(Goal)).second) {
+        Used_Starts.erase(Fleet.Single.Map.Index(Start));
+        continue;
+      }
+      Starts.push_back(Start);
+      Goals.push_back(Goal);
+    }
+
+    std::size_t Expanded = 0;
+    double Time = Time_Seconds([&]() {
+      Fleet.Table.Clear();
+      Fleet.Failed = 0;
+      for (int Agent = 0; Agent < Robots; ++Agent) {
+        auto path = Fleet.Single.findPath(Starts[Agent], Goals[Agent],
+                                          Fleet.Table);
+        Expanded += Fleet.Single.Expanded;
+        if (path.empty()) {
+          ++Fleet.Failed;
+        } else {
+          Fleet.Table.Reserve_Path(path, Agent);
+        }
+      }
+    });
+
+    /** Lookup throughput of the filled table */
+    const int Lookups = 1000000;
+    long Held = 0;
+    double Lookup_Time = Time_Seconds([&]() {
+      for (int i = 0; i < Lookups; ++i) {
+        Held += Fleet.Table.Owner({ X(Generator), Y(Generator),
+            Z(Generator) }, i % 64) >= 0;
+      }
+    });
+    std::cout << Robots << "\t" << Time << "\t" << Robots / Time << "\t"
+        << Fleet.Failed << "\t" << Expanded / Robots << "\t"
+        << Fleet.Table.Size() << "\t" << Fleet.Table.Bytes() / 1024 << "\t"
+        << Lookups / Lookup_Time << "\n";
+  }
+  return 0;
+}
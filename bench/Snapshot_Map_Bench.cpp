@@ -0,0 +1,153 @@
+/**
+ * @file Snapshot_Map_Bench.cpp
+ * @brief Benchmark of Snapshot_Map. Measures reader and writer throughput
+ * under mixed load against an Occupancy_Map guarded by one mutex.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/** --Includes--*/
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <functional>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+#include "Bench.h"
+#include "../include/Occupancy_Map.h"
+#include "../include/Snapshot_Map.h"
+
+/**
+ * @brief Mixed_Load runs reader threads, each repeatedly taking a view and
+ * checking 1000 random Nodes, while the calling thread keeps changing
+ * random Nodes and publishing, for a fixed time
+ * @param Readers_ of type int stores the number of reader threads
+ * @param Read_ is one reader query, it gets the Nodes to check
+ * @param Write_ is one writer update, it gets the Nodes to change
+ * @param Updates_ of type int stores the Nodes changed per update
+ * @param World_Size_ of type Vec3i struct stores the World Dimensions
+ * @return void, prints million lookups per second and updates per second
+ */
+static void Mixed_Load(int Readers_,
+                       const std::function<long(const std::vector<Vec3i>&)>&
+                           Read_,
+                       const std::function<void(const std::vector<Vec3i>&)>&
+                           Write_,
+                       int Updates_, Vec3i World_Size_) {
+  std::atomic<bool> Running(true);
+  std::atomic<long> Lookups(0), Occupied(0);
+  std::vector<std::thread> Threads;
+  auto Random_Nodes = [&](std::mt19937 *Generator_, std::size_t Count_) {
+    std::vector<Vec3i> Nodes(Count_);
+    for (auto& node : Nodes) {
+      node = {static_cast<int>((*Generator_)() % World_Size_.x),
+              static_cast<int>((*Generator_)() % World_Size_.y),
+              static_cast<int>((*Generator_)() % World_Size_.z)};
+    }
+    return Nodes;
+  };
+  for (int Reader = 0; Reader < Readers_; ++Reader) {
+    Threads.emplace_back([&, Reader]() {
+      std::mt19937 Generator(Reader + 1);
+      std::vector<Vec3i> Nodes = Random_Nodes(&Generator, 1000);
+      while (Running) {
+        Occupied += Read_(Nodes);
+        Lookups += Nodes.size();
+      }
+    });
+  }
+  std::mt19937 Generator(0);
+  long Updates = 0;
+  double Time = Time_Seconds([&]() {
+    auto End = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+    while (std::chrono::steady_clock::now() < End) {
+      Write_(Random_Nodes(&Generator, Updates_));
+      ++Updates;
+    }
+  });
+  Running = false;
+  for (auto& thread : Threads) {
+    thread.join();
+  }
+  std::cout << Lookups / Time / 1e6 << "\t\t" << Updates / Time << "\n";
+}
+
+/**
+ * @brief Snapshot_Map_Bench compares Snapshot_Map with an Occupancy_Map
+ * behind a mutex while readers query and one writer updates the map
+ * @param argc is an integer, options are [readers] [updates per publish]
+ * @param argv is a pointer to a pointer to a character.
+ * @return 0
+ */
+int Snapshot_Map_Bench(int argc, char **argv) {
+  int Readers = (argc > 1) ? std::atoi(argv[1]) : 4;
+  int Updates = (argc > 2) ? std::atoi(argv[2]) : 64;
+  Vec3i World_Size = { 128, 128, 32 };
+  std::cout << "snapshot: " << Readers << " readers, 1 writer changing "
+      << Updates << " Nodes per update, " << World_Size.x << "x"
+      << World_Size.y << "x" << World_Size.z << " map\n"
+      << "map\t\tmillion lookups/s\tupdates/s\n";
+
+  Occupancy_Map Locked(World_Size);
+  std::mutex Lock;
+  std::cout << "mutex\t\t";
+  Mixed_Load(Readers, [&](const std::vector<Vec3i>& Nodes_) {
+    long Occupied = 0;
+    std::lock_guard<std::mutex> Guard(Lock);
+    for (const Vec3i& node : Nodes_) {
+      Occupied += Locked.Is_Occupied(node);
+    }
+    return Occupied;
+  }, [&](const std::vector<Vec3i>& Nodes_) {
+    std::lock_guard<std::mutex> Guard(Lock);
+    for (const Vec3i& node : Nodes_) {
+      Locked.Set(node);
+    }
+  }, Updates, World_Size);
+
+  Snapshot_Map Map(World_Size);
+  std::cout << "snapshot\t";
+  Mixed_Load(Readers, [&](const std::vector<Vec3i>& Nodes_) {
+    long Occupied = 0;
+    Snapshot_Map::Snapshot View = Map.Read();
+    for (const Vec3i& node : Nodes_) {
+      Occupied += View.Is_Occupied(node);
+    }
+    return Occupied;
+  }, [&](const std::vector<Vec3i>& Nodes_) {
+    for (const Vec3i& node : Nodes_) {
+      Map.Set(node);
+    }
+    Map.Publish();
+  }, Updates, World_Size);
+  std::cout << "chunks copied per update: " << Map.Chunks_Copied
+      / static_cast<double>(std::max<uint64_t>(1, Map.Read().Epoch() - 1))
+      << " of " << (World_Size.x / 8) * (World_Size.y / 8) * (World_Size.z / 8)
+      << "\n";
+  return 0;
+}
@@ -0,0 +1,122 @@
+/**
+ * @file main.cpp
+ * @brief Contains main method for Benchmarks. The first argument selects a
+ * benchmark, every benchmark runs if it is missing.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/** --Includes--*/
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include "Bench.h"
+
+/**
+ * @brief Benchmark_World builds a Planner over a world split by walls
+ * @param World_Size_ of type Vec3i struct stores the World Dimensions
+ * @param Walls_ of type int stores the number of walls
+ * @return Planner with the Obstacles of the world and Octile heuristic
+ */
+Planner Benchmark_World(Vec3i World_Size_, int Walls_) {
+  Planner Plan = Planner(World_Size_);
+  Plan.Set_Heuristic(Planner::Octile);
+  int Window_Y = std::max(1, World_Size_.y / 8);
+  int Window_Z = std::max(1, World_Size_.z / 8);
+  for (int Wall = 1; Wall <= Walls_; ++Wall) {
+    int Counter_X = Wall * World_Size_.x / (Walls_ + 1);
+    bool Low = (Wall % 2 == 0);  ///< Alternate the window between corners
+    for (int Counter_Y = 0; Counter_Y < World_Size_.y; ++Counter_Y) {
+      for (int Counter_Z = 0; Counter_Z < World_Size_.z; ++Counter_Z) {
+        bool Window = Low ? (Counter_Y < Window_Y && Counter_Z < Window_Z)
+            : (Counter_Y >= World_Size_.y - Window_Y
+                && Counter_Z >= World_Size_.z - Window_Z);
+        if (!Window) {
+          Plan.Add_Collision({ Counter_X, Counter_Y, Counter_Z });
+        }
+      }
+    }
+  }
+  return Plan;
+}
+
+/**
+ * @brief Time_Seconds measures the wall clock time of a function
+ * @param Function_ is the function to measure
+ * @return time in seconds
+ */
+double Time_Seconds(const std::function<void()>& Function_) {
+  auto Begin = std::chrono::steady_clock::now();
+  Function_();
+  auto End = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(End - Begin).count();
+}
+
+/**
+ * @brief main method.
+ * Runs the benchmark named by the first argument, or all of them.
+ * @param argc is an integer.
+ * @param argv is a pointer to a pointer to a character.
+ * @return 0 if successful
+ */
+int main(int argc, char** argv) {
+  /** Benchmarks by name, in the order "all" runs them */
+  const struct {
+    const char *Name;
+    int (*Run)(int, char**);
+  } Benchmarks[] = {
+    { "parallel", Parallel_Planner_Bench },
+    { "geometry", Grid_Geometry_Bench },
+    { "ingest", Point_Cloud_Ingest_Bench },
+    { "fleet", Prioritized_Planner_Bench },
+    { "lazy", Lazy_Collision_Bench },
+    { "bounding", Goal_Bounding_Bench },
+    { "multires", Multi_Resolution_Bench },
+    { "snapshot", Snapshot_Map_Bench },
+    { "integer", Integer_Planner_Bench },
+    { "async", Async_Planner_Bench },
+    { "passability", Passability_Map_Bench },
+  };
+  const char *Name = (argc > 1) ? argv[1] : "all";
+  bool All = std::strcmp(Name, "all") == 0;
+  bool Found = false;
+  int Result = 0;
+  for (const auto& benchmark : Benchmarks) {
+    if (All || std::strcmp(Name, benchmark.Name) == 0) {
+      Found = true;
+      Result |= benchmark.Run(All ? 0 : argc - 1, argv + 1);
+    }
+  }
+  if (!Found) {
+    std::cout << "Unknown benchmark " << Name << "\nUsage: A_Star-bench [all";
+    for (const auto& benchmark : Benchmarks) {
+      std::cout << "|" << benchmark.Name;
+    }
+    std::cout << "] [options]\n";
+    return 1;
+  }
+  return Result;
+}
@@ -0,0 +1,162 @@
+/**
+ * @file Async_Planner.h
+ * @brief This file contains the declaration of Async_Planner class which
+ * plans on a background thread and streams the part of the path which is
+ * already certain, so a robot can start moving before planning ends.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MID_TERM_A_STAR_3D_INCLUDE_ASYNC_PLANNER_H_
+#define MID_TERM_A_STAR_3D_INCLUDE_ASYNC_PLANNER_H_
+
+/* --Includes-- */
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "Planner.h"
+#include "Integer_Planner.h"
+
+/**
+ * @brief Async_Planner class declaration. Queries run one after another on
+ * the planner thread. A greedy search first finds some path, whose cost is
+ * an upper bound U of the optimal cost. Then an Integer_Planner searches
+ * for the optimal path. Because its heuristic is consistent, expanded
+ * Nodes keep their Parent and the final path runs through an Open Node
+ * with F value at most U. The longest prefix shared by the Parent chains
+ * of those Open Nodes is therefore part of the final path. It is
+ * recomputed every Commit_Interval expansions and published as it grows.
+ */
+class Async_Planner {
+ public:  ///< Public Access Specifier
+  /**
+   * @brief Job class is the handle of one query. Every method can be called
+   * from any thread while the query runs.
+   */
+  class Job {
+   public:  ///< Public Access Specifier
+    /** Status of type enum gives the progress of the query */
+    enum Status { Queued, Running, Found, Not_Found, Cancelled };
+    /** Get_Status returns the current Status */
+    Status Get_Status() const;
+    /** Cancel stops the query, or drops it if it has not started yet */
+    void Cancel();
+    /**
+     * Committed returns the path from the Start which is certain to begin
+     * the final path, at least the Start once the query is running
+     */
+    std::vector<Vec3i> Committed() const;
+    /**
+     * Best returns the greedy path to the Goal once it is found, which may
+     * differ from the final path, or the final path. Lower_Bound_ and
+     * Upper_Bound_ are set to bounds of the cost of the final path, the
+     * upper bound is the cost of the greedy path.
+     */
+    std::vector<Vec3i> Best(int *Lower_Bound_ = nullptr,
+                            int *Upper_Bound_ = nullptr) const;
+    /**
+     * Wait_Best blocks until a path to the Goal is known or the query
+     * ended, and returns Best
+     */
+    std::vector<Vec3i> Wait_Best(int *Lower_Bound_ = nullptr,
+                                 int *Upper_Bound_ = nullptr) const;
+    /**
+     * Wait_Committed blocks until the committed path has at least the given
+     * number of Nodes or the query ended, and returns the committed path
+     */
+    std::vector<Vec3i> Wait_Committed(std::size_t) const;
+    /**
+     * Wait blocks until the query ended and returns the path from Start to
+     * Goal, empty if the Goal is unreachable or the query was cancelled
+     */
+    std::vector<Vec3i> Wait() const;
+    /** Start and Goal of the query */
+    const Vec3i Start, Goal;
+    virtual ~Job();  ///< Destructor for Job Class
+
+   private:  ///< Private Access Specifier
+    friend class Async_Planner;
+    Job(Vec3i, Vec3i, std::function<void(const std::vector<Vec3i>&)>);
+    /** On_Commit is called on the planner thread when Prefix grows */
+    std::function<void(const std::vector<Vec3i>&)> On_Commit;
+    mutable std::mutex Lock;  ///< Guards the members below
+    mutable std::condition_variable Changed;  ///< Signals any change
+    Status State;  ///< Status of the query
+    std::vector<Vec3i> Prefix;  ///< Committed path
+    std::vector<Vec3i> Best_Path;  ///< Greedy path or final path
+    int Lower, Upper;  ///< Bounds of the cost of the final path
+    std::atomic<bool> Stop;  ///< Set by Cancel
+  };
+
+  /**
+   * Constructor for Class Async_Planner. Copies the World Size, Obstacles
+   * and Directions of the given Planner and starts the planner thread.
+   */
+  explicit Async_Planner(const Planner&);
+  /**
+   * Submit queues a query and returns its handle immediately. On_Commit_,
+   * if given, is called on the planner thread with the committed path every
+   * time it grows, last with the whole path.
+   */
+  std::shared_ptr<Job> Submit(Vec3i, Vec3i,
+                              std::function<void(const std::vector<Vec3i>&)>
+                                  On_Commit_ = nullptr);
+  /** Commit_Interval is the number of expansions between two commits */
+  std::size_t Commit_Interval;
+  virtual ~Async_Planner();  ///< Destructor cancels queries and stops
+
+ private:  ///< Private Access Specifier
+  /** Run is the body of the planner thread */
+  void Run();
+  /** Plan runs one query and publishes its progress */
+  void Plan(Job*);
+  /**
+   * Greedy runs a greedy best first search, stores the path it finds from
+   * the Start and returns its cost, -1 if there is none
+   */
+  int Greedy(Job*, std::vector<Vec3i>*);
+  /** Commit recomputes the committed path and bounds of a running query */
+  void Commit(Job*, int);
+
+  Integer_Planner Search;  ///< Search used by the planner thread only
+  /** Stamp and Resolved are scratch space of Commit, one entry per Node */
+  std::vector<uint32_t> Stamp;
+  std::vector<int> Resolved;
+  uint32_t Round;  ///< Stamp of the current Commit
+  std::mutex Queue_Mutex;  ///< Guards Queue, Current and Stopping
+  std::condition_variable Queue_Ready;  ///< Signals a new Job or Stop
+  std::deque<std::shared_ptr<Job>> Queue;  ///< Jobs waiting to run
+  std::shared_ptr<Job> Current;  ///< Job running on the planner thread
+  bool Stopping;  ///< Set by the destructor to end the planner thread
+  std::thread Worker;  ///< Planner thread
+};
+
+#endif  // MID_TERM_A_STAR_3D_INCLUDE_ASYNC_PLANNER_H_
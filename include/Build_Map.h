@@ -38,19 +38,26 @@
 #include <functional>
 #include <set>
 #include "Planner.h"
+#include "Grid_Geometry.h"
 
 /**
- * @brief Build_Map class declaration.
+ * @brief Build_Map class declaration. The vector methods are thin wrappers
+ * around Geometry, which should be used directly on hot paths. All data
+ * members are set once by the constructor from Geometry and are read only,
+ * so they always agree with the conversions.
  */
 class Build_Map {
  public:  ///< Public Access Specifier
-  Build_Map(std::vector<double>, double, double, double);  ///< Constructor
+  /** Constructor */
+  Build_Map(const std::vector<double>&, double, double, double);
+  /** Geometry of type Grid_Geometry, converts points without allocating */
+  const Grid_Geometry Geometry;
   /** Boundary of type double vector, Stores World Boundary Data */
-  std::vector<double> Boundary;
+  const std::vector<double> Boundary;
   /** World of type integer vector, Stores Discretized World Dimensions */
-  std::vector<int> World;
+  const std::vector<int> World;
   /** x,y,z Resolutions and Robot Dimensions Margin Data of type double */
-  double xy_res, z_res, margin;
+  const double xy_res, z_res, margin;
   /**
    * @brief World_Dimensions function returns the Discretized World Dimensions
    */
@@ -59,17 +66,17 @@ class Build_Map {
    * @brief Build_Obstacle Creates Obstacle Representations in Discretized
    * Workspace given the Obstacle Blocks in World.
    */
-  std::vector<int> Build_Obstacle(std::vector<double>);
+  std::vector<int> Build_Obstacle(const std::vector<double>&);
   /**
    * @brief Build_Node creates the representation of a point from the world in
    * Discretized Workspace
    */
-  std::vector<int> Build_Node(std::vector<double>);
+  std::vector<int> Build_Node(const std::vector<double>&);
   /**
    * @brief Get_Coordinate creates the representation of a point from location
    * in the Discretized Workspace
    */
-  std::vector<double> Get_Coordinate(std::vector<int>);
+  std::vector<double> Get_Coordinate(const std::vector<int>&);
   virtual ~Build_Map();  ///< Destructor for Class Build_Map
 };
 
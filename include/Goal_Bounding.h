@@ -0,0 +1,112 @@
+/**
+ * @file Goal_Bounding.h
+ * @brief This file contains the declarations of variables and methods for
+ * Goal_Bounding class. For every free Node and every Planner::direction it
+ * stores the bounding box of the Goals whose shortest path starts with that
+ * move, computed once for a static map by parallel Dijkstra floods. Queries
+ * skip every move whose box does not contain their Goal. The table is
+ * compressed to indices into a palette of distinct boxes and can be saved
+ * to a file which is loaded with mmap.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MID_TERM_A_STAR_3D_INCLUDE_GOAL_BOUNDING_H_
+#define MID_TERM_A_STAR_3D_INCLUDE_GOAL_BOUNDING_H_
+
+/* --Includes-- */
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Planner.h"
+
+/**
+ * @brief Declaration of Class Goal_Bounding
+ */
+class Goal_Bounding {
+ public:  ///< Public Access Specifier
+  /**
+   * @brief Box16 of type Struct stores a box of Nodes, both corners
+   * inclusive. An empty box has Min greater than Max.
+   */
+  struct Box16 {
+    uint16_t Min[3], Max[3];
+  };
+
+  Goal_Bounding();  ///< Constructor for Class Goal_Bounding
+  /**
+   * Build floods the map of a Planner from every free Node using the given
+   * number of threads (0 uses all hardware threads) and fills the table.
+   * Worlds are limited to 65535 Nodes along each axis and 256 Directions,
+   * larger Planners leave the table empty.
+   */
+  void Build(const Planner&, int Threads_ = 0);
+  /** Save writes the table to a file, returns false on failure */
+  bool Save(const std::string&) const;
+  /**
+   * Load maps a table saved by Save into memory with mmap, returns false
+   * and leaves the table empty if the file is not a valid table
+   */
+  bool Load(const std::string&);
+  /**
+   * Allows returns true if moving from a Node along a direction, given by
+   * its index in Planner::direction, can start a shortest path to the Goal
+   */
+  bool Allows(Vec3i, int, Vec3i) const;
+  /** Box returns the box of a Node and direction */
+  const Box16& Box(Vec3i, int) const;
+  /** Empty returns true if no table was built or loaded */
+  bool Empty() const;
+  /** Bytes returns the size of the compressed table */
+  std::size_t Bytes() const;
+  /** Raw_Bytes returns the size the table would have without the palette */
+  std::size_t Raw_Bytes() const;
+  /** World_Size of type Vec3i struct contains world dimensions */
+  Vec3i World_Size;
+  /** Directions is the number of Planner directions stored per Node */
+  int Directions;
+  /** Palette_Size is the number of distinct boxes */
+  std::size_t Palette_Size;
+  virtual ~Goal_Bounding();  ///< Destructor for Goal_Bounding Class
+
+ private:  ///< Private Access Specifier
+  /** Unmap releases a loaded file */
+  void Unmap();
+  /** Palette and Index point into the owned vectors or the mapped file */
+  const Box16 *Palette;
+  const uint32_t *Index;
+  /** Owned_Palette and Owned_Index store a table built in memory */
+  std::vector<Box16> Owned_Palette;
+  std::vector<uint32_t> Owned_Index;
+  /** Mapped and Mapped_Bytes describe the file mapped by Load */
+  void *Mapped;
+  std::size_t Mapped_Bytes;
+
+  Goal_Bounding(const Goal_Bounding&) = delete;
+  Goal_Bounding& operator=(const Goal_Bounding&) = delete;
+};
+
+#endif  // MID_TERM_A_STAR_3D_INCLUDE_GOAL_BOUNDING_H_
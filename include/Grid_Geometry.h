@@ -0,0 +1,189 @@
+/**
+ * @file Grid_Geometry.h
+ * @brief This file contains the declarations of the value types and the
+ * Grid_Geometry class which converts points between the World and the
+ * Discretized Workspace without any heap allocation. The conversions are
+ * constexpr, and batched versions convert whole point arrays with SIMD
+ * instructions.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MID_TERM_A_STAR_3D_INCLUDE_GRID_GEOMETRY_H_
+#define MID_TERM_A_STAR_3D_INCLUDE_GRID_GEOMETRY_H_
+
+/* --Includes-- */
+#include <cstddef>
+#include "Planner.h"
+
+/**
+ * @brief Vec3d of type Struct which stores a point of the World
+ */
+struct Vec3d {
+  /** x,y,z of type double */
+  double x, y, z;
+};
+
+/**
+ * @brief Box3d of type Struct which stores a block of the World in
+ * {xmin,ymin,zmin,xmax,ymax,zmax} format
+ */
+struct Box3d {
+  /** Min and Max corners of type Vec3d */
+  Vec3d Min, Max;
+};
+
+/**
+ * @brief Box3i of type Struct which stores a block of Nodes of the
+ * Discretized Workspace. Min is inclusive and Max is exclusive.
+ */
+struct Box3i {
+  /** Min and Max corners of type Vec3i */
+  Vec3i Min, Max;
+};
+
+/**
+ * @brief Grid_Geometry class declaration. All members are computed once in
+ * the constructor. Points are converted to Nodes by dividing by the
+ * Resolution like the vector API of Build_Map, so points on a cell boundary
+ * land in the same Node.
+ */
+class Grid_Geometry {
+ public:  ///< Public Access Specifier
+  /**
+   * @brief Constructor for Grid_Geometry Class
+   * @param Boundary_ has type Box3d and stores the World Boundary
+   * @param xy_res_ has type double and stores x,y resolution
+   * @param z_res_ has type double and stores z resolution
+   * @param margin_ has type double and stores the margin value for Robot
+   * Dimensions
+   */
+  constexpr Grid_Geometry(Box3d Boundary_, double xy_res_, double z_res_,
+                          double margin_)
+      : Boundary(Boundary_),
+        Resolution({xy_res_, xy_res_, z_res_}),
+        margin(margin_),
+        World({
+          static_cast<int>((Boundary_.Max.x - Boundary_.Min.x) / xy_res_),
+          static_cast<int>((Boundary_.Max.y - Boundary_.Min.y) / xy_res_),
+          static_cast<int>((Boundary_.Max.z - Boundary_.Min.z) / z_res_)}) {
+  }
+  /** Boundary of type Box3d, Stores World Boundary Data */
+  Box3d Boundary;
+  /** Resolution along x,y,z of type Vec3d */
+  Vec3d Resolution;
+  /** Robot Dimensions Margin Data of type double */
+  double margin;
+  /** World of type Vec3i, Stores Discretized World Dimensions */
+  Vec3i World;
+
+  /**
+   * @brief To_Cell creates the representation of a point from the world in
+   * Discretized Workspace, truncating towards zero like Build_Map::Build_Node
+   * @param Point_ has type Vec3d and stores a point of the World
+   * @return Vec3i type Node of the Discretized Workspace
+   */
+  constexpr Vec3i To_Cell(Vec3d Point_) const {
+    return {static_cast<int>((Point_.x - Boundary.Min.x) / Resolution.x),
+            static_cast<int>((Point_.y - Boundary.Min.y) / Resolution.y),
+            static_cast<int>((Point_.z - Boundary.Min.z) / Resolution.z)};
+  }
+
+  /**
+   * @brief To_Point creates the representation of a point from location in
+   * the Discretized Workspace
+   * @param Cell_ has type Vec3i and stores a Node of the Discretized Workspace
+   * @return Vec3d type point of the World
+   */
+  constexpr Vec3d To_Point(Vec3i Cell_) const {
+    return {Boundary.Min.x + Cell_.x * Resolution.x,
+            Boundary.Min.y + Cell_.y * Resolution.y,
+            Boundary.Min.z + Cell_.z * Resolution.z};
+  }
+
+  /**
+   * @brief Obstacle_Cells Creates Obstacle Representations in Discretized
+   * Workspace given an Obstacle Block in World, grown by the margin and
+   * clipped to the World
+   * @param Obstacle_ has type Box3d and stores the Obstacle Block
+   * @return Box3i type block of Obstacle Nodes
+   */
+  constexpr Box3i Obstacle_Cells(Box3d Obstacle_) const {
+    return {{Max(Floor((Obstacle_.Min.x - Boundary.Min.x - margin)
+                       / Resolution.x), 0),
+             Max(Floor((Obstacle_.Min.y - Boundary.Min.y - margin)
+                       / Resolution.y), 0),
+             Max(Floor((Obstacle_.Min.z - Boundary.Min.z - margin)
+                       / Resolution.z), 0)},
+            {Min(Ceil((Obstacle_.Max.x - Boundary.Min.x + margin)
+                      / Resolution.x), World.x),
+             Min(Ceil((Obstacle_.Max.y - Boundary.Min.y + margin)
+                      / Resolution.y), World.y),
+             Min(Ceil((Obstacle_.Max.z - Boundary.Min.z + margin)
+                      / Resolution.z), World.z)}};
+  }
+
+  /**
+   * @brief Contains checks if a point lies inside the World Boundary
+   * @param Point_ has type Vec3d and stores a point of the World
+   * @return true if the point lies inside the World Boundary
+   */
+  constexpr bool Contains(Vec3d Point_) const {
+    return Point_.x >= Boundary.Min.x && Point_.x <= Boundary.Max.x
+        && Point_.y >= Boundary.Min.y && Point_.y <= Boundary.Max.y
+        && Point_.z >= Boundary.Min.z && Point_.z <= Boundary.Max.z;
+  }
+
+  /**
+   * To_Cells converts an array of points to Nodes, same as To_Cell for each
+   * point, several points per SIMD instruction.
+   */
+  void To_Cells(const Vec3d*, std::size_t, Vec3i*) const;
+  /**
+   * To_Points converts an array of Nodes to points, same as To_Point for
+   * each Node, several Nodes per SIMD instruction.
+   */
+  void To_Points(const Vec3i*, std::size_t, Vec3d*) const;
+
+ private:  ///< Private Access Specifier
+  /** Floor and Ceil are constexpr versions of std::floor and std::ceil */
+  static constexpr int Floor(double Value_) {
+    return (Value_ < static_cast<int>(Value_)) ? static_cast<int>(Value_) - 1
+        : static_cast<int>(Value_);
+  }
+  static constexpr int Ceil(double Value_) {
+    return (Value_ > static_cast<int>(Value_)) ? static_cast<int>(Value_) + 1
+        : static_cast<int>(Value_);
+  }
+  /** Min and Max are constexpr versions of std::min and std::max */
+  static constexpr int Min(int Left_, int Right_) {
+    return (Left_ < Right_) ? Left_ : Right_;
+  }
+  static constexpr int Max(int Left_, int Right_) {
+    return (Left_ > Right_) ? Left_ : Right_;
+  }
+};
+
+#endif  // MID_TERM_A_STAR_3D_INCLUDE_GRID_GEOMETRY_H_
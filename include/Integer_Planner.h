@@ -0,0 +1,133 @@
+/**
+ * @file Integer_Planner.h
+ * @brief This file contains the declaration of Integer_Planner class, an
+ * A* over integer costs with a bucket priority queue and deterministic tie
+ * breaking.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MID_TERM_A_STAR_3D_INCLUDE_INTEGER_PLANNER_H_
+#define MID_TERM_A_STAR_3D_INCLUDE_INTEGER_PLANNER_H_
+
+/* --Includes-- */
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+#include "Planner.h"
+#include "Occupancy_Map.h"
+
+/**
+ * @brief Bucket_Queue class declaration. A priority queue for integer F
+ * values which only grow by less than the number of buckets past the least
+ * F value, which holds for the integer Octile heuristic. The buckets form a
+ * ring indexed by F, each one a heap ordered by G.
+ */
+class Bucket_Queue {
+ public:  ///< Public Access Specifier
+  /** Entry of type Struct is an element of the queue */
+  struct Entry {
+    int G;  ///< Cost-to-Start value
+    std::size_t Cell;  ///< Index of the Node
+  };
+  /** Constructor, F values may exceed the least one by at most Max_Spread_ */
+  explicit Bucket_Queue(int Max_Spread_);
+  /** Push adds an Entry with the given F value */
+  void Push(int, Entry);
+  /**
+   * Pop removes the Entry with least F value, ties prefer the higher G and
+   * then the lower Cell. Returns false if the queue is empty.
+   */
+  bool Pop(Entry*);
+  /** Empty returns true if the queue holds no Entry */
+  bool Empty() const;
+  /** Clear removes every Entry */
+  void Clear();
+  /** For_Each calls a function with every Entry, in no particular order */
+  void For_Each(const std::function<void(const Entry&)>&) const;
+  /** Least_F is the F value of the bucket the next Pop starts from */
+  int Least_F;
+  virtual ~Bucket_Queue();  ///< Destructor for Bucket_Queue Class
+
+ private:  ///< Private Access Specifier
+  std::vector<std::vector<Entry>> Buckets;  ///< Ring of heaps indexed by F
+  std::size_t Mask;  ///< Number of buckets minus one
+  std::size_t Count;  ///< Number of entries
+};
+
+/**
+ * @brief Declaration of Class Integer_Planner
+ */
+class Integer_Planner {
+ public:  ///< Public Access Specifier
+  /**
+   * Constructor for Class Integer_Planner. Copies the World Size, Obstacles
+   * and Directions of the given Planner.
+   */
+  explicit Integer_Planner(const Planner&);
+  /**
+   * findPath Plans the Path from Start to Goal Point with integer costs and
+   * the integer Octile heuristic. The same query always expands the same
+   * Nodes in the same order and returns the same path. Returns the path
+   * from Goal to Start like Planner::findPath, or an empty path if the Goal
+   * is unreachable.
+   */
+  std::vector<Vec3i> findPath(Vec3i, Vec3i);
+  /** Heuristic is the exact integer Octile distance */
+  static int Heuristic(Vec3i, Vec3i);
+  /** direction contains direction of movement from current to neighbor node */
+  std::vector<Vec3i> direction;
+  /** Step_Costs contains the integer cost of each direction */
+  std::vector<int> Step_Costs;
+  /** Map stores the Obstacle Nodes */
+  Occupancy_Map Map;
+  /** Expanded counts the Nodes expanded by the last findPath */
+  std::size_t Expanded;
+  /** Cost is the cost of the last path, -1 if none was found */
+  int Cost;
+  /**
+   * Progress is called every Progress_Interval expansions while findPath
+   * runs and may read the search state below. If it returns false findPath
+   * stops, sets Cancelled and returns an empty path.
+   */
+  std::function<bool()> Progress;
+  std::size_t Progress_Interval;
+  /** Cancelled is true if Progress stopped the last findPath */
+  bool Cancelled;
+  /**
+   * Search state of the last or running findPath, indexed like Map.Cells:
+   * the G value, Parent and Closed flag of every Node, and the Open List
+   */
+  std::vector<int> G;
+  std::vector<std::size_t> Parent;
+  std::vector<uint8_t> Closed;
+  Bucket_Queue Open;
+  /** Is_Open returns true if an Entry of Open is not stale */
+  bool Is_Open(const Bucket_Queue::Entry&) const;
+  virtual ~Integer_Planner();  ///< Destructor for Integer_Planner Class
+};
+
+#endif  // MID_TERM_A_STAR_3D_INCLUDE_INTEGER_PLANNER_H_
@@ -0,0 +1,101 @@
+/**
+ * @file Multi_Resolution_Planner.h
+ * @brief This file contains the declaration of Multi_Resolution_Planner
+ * class which plans on a pyramid of coarser occupancy maps first and then
+ * plans the full resolution path inside a corridor around the coarse path.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MID_TERM_A_STAR_3D_INCLUDE_MULTI_RESOLUTION_PLANNER_H_
+#define MID_TERM_A_STAR_3D_INCLUDE_MULTI_RESOLUTION_PLANNER_H_
+
+/* --Includes-- */
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Planner.h"
+#include "Occupancy_Map.h"
+
+/**
+ * @brief Declaration of Class Multi_Resolution_Planner
+ */
+class Multi_Resolution_Planner {
+ public:  ///< Public Access Specifier
+  /**
+   * Constructor for Class Multi_Resolution_Planner. Copies the Obstacles
+   * and Directions of the given Planner and builds the given number of
+   * coarse levels, 0 builds levels until every axis is a single Node. The
+   * Node size of the World, such as Build_Map xy_res and z_res, decides
+   * which axes each level coarsens.
+   */
+  explicit Multi_Resolution_Planner(const Planner&, int Levels_ = 0,
+                                    double xy_res_ = 1, double z_res_ = 1);
+  /**
+   * findPath Plans the Path from Start to Goal Point. It searches the level
+   * Coarse_Level, then searches the full resolution map only inside the
+   * coarse path dilated by Corridor_Radius coarse Nodes. If either search
+   * fails it retries one level finer, down to a full resolution search.
+   * Returns the path from Goal to Start like Planner::findPath, or an empty
+   * path if the Goal is unreachable.
+   */
+  std::vector<Vec3i> findPath(Vec3i, Vec3i);
+  /**
+   * Levels stores the occupancy pyramid. Levels[0] is the full resolution
+   * map and each coarser Node is an Obstacle if any of its finer Nodes is.
+   */
+  std::vector<Occupancy_Map> Levels;
+  /**
+   * Scale stores the number of full resolution Nodes along each axis of a
+   * Node of each level. Each level halves x and y, z, or all three,
+   * whichever side of a Node is shortest in World units, so with a z_res
+   * twice xy_res the first level halves x and y only. An axis stops being
+   * halved once it is one Node.
+   */
+  std::vector<Vec3i> Scale;
+  /** direction contains direction of movement from current to neighbor node */
+  std::vector<Vec3i> direction;
+  /** Coarse_Level is the level of the first search, 0 disables the pyramid */
+  int Coarse_Level;
+  /** Corridor_Radius is the dilation of the coarse path in coarse Nodes */
+  int Corridor_Radius;
+  /** Used_Level is the coarse level which guided the last path, 0 if none */
+  int Used_Level;
+  /** Expanded counts the Nodes expanded by the last findPath on all levels */
+  std::size_t Expanded;
+  virtual ~Multi_Resolution_Planner();  ///< Destructor
+
+ private:  ///< Private Access Specifier
+  /**
+   * Search runs A* on one level, optionally only through the full
+   * resolution Nodes marked in a Corridor. Start and Goal are never treated
+   * as Obstacles on coarse levels, where pooling may cover them.
+   */
+  std::vector<Vec3i> Search(int, Vec3i, Vec3i, const std::vector<uint8_t>*);
+  /** To_Level gives the Node of a level containing a full resolution Node */
+  Vec3i To_Level(int, Vec3i) const;
+};
+
+#endif  // MID_TERM_A_STAR_3D_INCLUDE_MULTI_RESOLUTION_PLANNER_H_
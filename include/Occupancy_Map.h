@@ -0,0 +1,78 @@
+/**
+ * @file Occupancy_Map.h
+ * @brief This file contains the declarations of variables and methods for
+ * Occupancy_Map class which stores the Obstacle Nodes of the Discretized
+ * Workspace as a dense grid so that collision lookups take constant time.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MID_TERM_A_STAR_3D_INCLUDE_OCCUPANCY_MAP_H_
+#define MID_TERM_A_STAR_3D_INCLUDE_OCCUPANCY_MAP_H_
+
+/* --Includes-- */
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Planner.h"
+
+/**
+ * @brief Occupancy_Map class declaration.
+ */
+class Occupancy_Map {
+ public:  ///< Public Access Specifier
+  explicit Occupancy_Map(Vec3i);  ///< Constructor
+  /** World_Size of type Vec3i struct contains world dimensions */
+  Vec3i World_Size;
+  /** Cells stores one byte per Node, non zero if the Node is an Obstacle */
+  std::vector<uint8_t> Cells;
+  /** Inside returns true if the Node lies inside the World */
+  bool Inside(Vec3i) const;
+  /**
+   * Is_Occupied returns true if the Node is an Obstacle or lies outside the
+   * World, which is the same test as Planner::Detect_Collision.
+   */
+  bool Is_Occupied(Vec3i) const;
+  /** Set marks the Node as an Obstacle */
+  void Set(Vec3i);
+  /** Clear marks the Node as Free */
+  void Clear(Vec3i);
+  /** Add_Walls marks every Node of a Planner walls list as an Obstacle */
+  void Add_Walls(const std::vector<Vec3i>&);
+  /**
+   * Add_Obstacles marks every Obstacle of a Planner, its walls and the map
+   * set with Planner::Set_Occupancy
+   */
+  void Add_Obstacles(const Planner&);
+  /** Index gives the position of a Node inside Cells */
+  std::size_t Index(Vec3i) const;
+  /** Coordinates gives the Node stored at a position of Cells */
+  Vec3i Coordinates(std::size_t) const;
+  /** Size gives the number of Nodes in the World */
+  std::size_t Size() const;
+  virtual ~Occupancy_Map();  ///< Destructor for Class Occupancy_Map
+};
+
+#endif  // MID_TERM_A_STAR_3D_INCLUDE_OCCUPANCY_MAP_H_
@@ -0,0 +1,83 @@
+/**
+ * @file Parallel_Planner.h
+ * @brief This file contains the declarations of variables and methods for
+ * Parallel_Planner class which plans a single Start to Goal query on many
+ * threads using Hash Distributed A* (HDA*). Every Node is owned by exactly
+ * one thread, chosen by hashing its coordinates, and generated Nodes are
+ * sent to their owner through lock-free message queues.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MID_TERM_A_STAR_3D_INCLUDE_PARALLEL_PLANNER_H_
+#define MID_TERM_A_STAR_3D_INCLUDE_PARALLEL_PLANNER_H_
+
+/* --Includes-- */
+#include <cstddef>
+#include <functional>
+#include <vector>
+#include "Planner.h"
+#include "Occupancy_Map.h"
+
+/**
+ * @brief Declaration of Class Parallel_Planner
+ */
+class Parallel_Planner {
+  /** Private Access Specifier */
+
+  /** Worker runs the search loop of one thread */
+  struct Worker;
+  /** Search holds the state shared by all Workers of one query */
+  struct Search;
+  /** Run_Worker is the body of each search thread */
+  static void Run_Worker(Search*, int);
+
+ public:  ///< Public Access Specifier
+  /**
+   * Constructor for Class Parallel_Planner. Copies the World Size, Obstacles,
+   * Directions and Heuristic of the given Planner.
+   */
+  explicit Parallel_Planner(const Planner&);
+  /**
+   * findPath Plans the Path from Start to Goal Point using the given number
+   * of threads (0 uses all hardware threads). The path has the same cost as
+   * Planner::findPath when the heuristic never overestimates, such as
+   * Planner::Octile. Returns an empty path if the Goal can not be reached.
+   */
+  std::vector<Vec3i> findPath(Vec3i, Vec3i, int Threads_ = 0);
+  /** Heuristic Function */
+  std::function<double(Vec3i, Vec3i)> heuristic;
+  /** direction contains direction of movement from current to neighbor node */
+  std::vector<Vec3i> direction;
+  /** Map stores the Obstacle Nodes */
+  Occupancy_Map Map;
+  /** Expanded counts the Nodes expanded by the last findPath */
+  std::size_t Expanded;
+  /** Messages counts the Nodes sent between threads by the last findPath */
+  std::size_t Messages;
+  virtual ~Parallel_Planner();  ///< Destructor for Parallel_Planner Class
+};
+
+#endif  // MID_TERM_A_STAR_3D_INCLUDE_PARALLEL_PLANNER_H_
@@ -0,0 +1,95 @@
+/**
+ * @file Passability_Map.h
+ * @brief This file contains the declarations of variables and methods for
+ * Passability_Map class. For every Node it stores a mask with one bit per
+ * Planner::direction, set if the move sweeps only free Nodes, so diagonal
+ * moves never cut the corner of an Obstacle.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MID_TERM_A_STAR_3D_INCLUDE_PASSABILITY_MAP_H_
+#define MID_TERM_A_STAR_3D_INCLUDE_PASSABILITY_MAP_H_
+
+/* --Includes-- */
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Planner.h"
+#include "Occupancy_Map.h"
+
+/**
+ * @brief Passability_Map class declaration. A move is passable if its
+ * destination and every Node of the unit cube it crosses are free, which
+ * is one Node for a straight move, three for a planar diagonal and seven
+ * for a cubic diagonal. The masks are read without locks, so Set and
+ * Clear must not run while another thread reads them.
+ */
+class Passability_Map {
+ public:  ///< Public Access Specifier
+  /**
+   * Constructor for Class Passability_Map. Copies the World Size,
+   * Obstacles and Directions of a Planner, at most 32 Directions of
+   * length one, and computes the masks of all Nodes using the given number
+   * of threads (0 uses all hardware threads).
+   */
+  explicit Passability_Map(const Planner&, int Threads_ = 0);
+  /**
+   * Mask returns the passable moves from a Node, bit i for direction[i],
+   * 0 for an Obstacle or a Node outside the World
+   */
+  uint32_t Mask(Vec3i) const;
+  /** Lowest_Move returns the index of the lowest bit set in a non zero mask */
+  static int Lowest_Move(uint32_t);
+  /** Allows returns true if the move along direction[i] is passable */
+  bool Allows(Vec3i, int) const;
+  /** Set marks the Node as an Obstacle and updates the masks around it */
+  void Set(Vec3i);
+  /** Clear marks the Node as Free and updates the masks around it */
+  void Clear(Vec3i);
+  /** Map stores the Obstacle Nodes */
+  Occupancy_Map Map;
+  /** direction contains the moves the mask bits stand for */
+  std::vector<Vec3i> direction;
+  /** Masks stores one mask per Node, indexed like Map.Cells */
+  std::vector<uint32_t> Masks;
+  virtual ~Passability_Map();  ///< Destructor for Passability_Map Class
+
+ private:  ///< Private Access Specifier
+  /**
+   * Compute builds the mask of a Node from the free Nodes of its 3x3x3
+   * neighborhood
+   */
+  uint32_t Compute(Vec3i) const;
+  /** Update recomputes the masks of the 3x3x3 neighborhood of a Node */
+  void Update(Vec3i);
+  /**
+   * Sweeps has one entry per direction with a bit for each Node of the
+   * 3x3x3 neighborhood, x fastest, that the move crosses
+   */
+  std::vector<uint32_t> Sweeps;
+};
+
+#endif  // MID_TERM_A_STAR_3D_INCLUDE_PASSABILITY_MAP_H_
@@ -33,10 +33,18 @@
 #define MID_TERM_A_STAR_3D_INCLUDE_PLANNER_H_
 
 /* --Includes-- */
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 #include <functional>
+#include <memory>
 #include <set>
 
+class Occupancy_Map;
+class Goal_Bounding;
+class Passability_Map;
+class Snapshot_Map;
+
 /**
  * @brief Vec3i of type Struct which Builds points with x,y,z values
  */
@@ -44,7 +52,18 @@ struct Vec3i {
   /** x,y,z of type integer */
   int x, y, z;
   /** operator of type boolean */
-  bool operator ==(const Vec3i& coordinates_);
+  bool operator ==(const Vec3i& coordinates_) const;
+};
+
+/**
+ * @brief Occupancy_View of type Class is a read only set of Obstacle Nodes,
+ * such as a Snapshot_Map Snapshot, checked by Planner::Detect_Collision
+ */
+class Occupancy_View {
+ public:  ///< Public Access Specifier
+  /** Is_Occupied returns true if the Node is an Obstacle */
+  virtual bool Is_Occupied(Vec3i) const = 0;
+  virtual ~Occupancy_View();  ///< Destructor for Occupancy_View Class
 };
 
 /**
@@ -60,6 +79,8 @@ struct Node {
   Vec3i coordinates;
   /** Parent of type pointer which points to the parent node of current node */
   Node *Parent;
+  /** Checked of type bool is true once the Node is known to be free */
+  bool Checked;
   /** Constructor for Node Struct */
   explicit Node(Vec3i, Node *Parent_ = nullptr);
   /** Get_Score returns the F value of type double (F=G+H) */
@@ -77,21 +98,79 @@ class Planner {
    * Node is inside an obstacle.
    */
   bool Detect_Collision(Vec3i);
+  /** Inside_World returns true if the Node lies inside the World */
+  bool Inside_World(Vec3i);
+  /**
+   * Check_Collision calls Detect_Collision and counts the call. With a non
+   * empty Memo each Node is checked at most once per query.
+   */
+  bool Check_Collision(Vec3i, std::vector<uint8_t>& Memo_);
   /** Find Node finds the Location of Given Node in List of Nodes */
   Node* Find_Node(std::set<Node*>& nodes_, Vec3i);
   /** Distance finds the Distance between two nodes */
   static Vec3i Distance(Vec3i, Vec3i);
+  /** Expands_Before orders Open Nodes, deterministic on ties */
+  static bool Expands_Before(Node*, Node*);
+  /** pinned is the Snapshot held by the running query, null otherwise */
+  const Occupancy_View *pinned;
 
  public:  ///< Public Access Specifier
   explicit Planner(Vec3i);  ///< Constructor for Class Planner
   static double Euclidean(Vec3i, Vec3i);  ///< Euclidean Distance Heuristic
   static double Manhattan(Vec3i, Vec3i);  ///< Manhattan Distance Heuristic
+  static double Octile(Vec3i, Vec3i);  ///< Octile Distance Heuristic
+  /** Step_Cost returns the cost of moving along a direction */
+  static int Step_Cost(Vec3i);
+  /** Path_Cost returns the total cost of a path returned by findPath */
+  static double Path_Cost(const std::vector<Vec3i>&);
   /** Set_Heuristic sets the Heuristic Function */
   void Set_Heuristic(std::function<double(Vec3i, Vec3i)>);
+  /**
+   * Set_Lazy_Collision makes findPath add neighbors to the Open Set without
+   * checking them and check each Node only when it is selected (Lazy A*)
+   */
+  void Set_Lazy_Collision(bool);
+  /**
+   * Set_Collision_Memo makes findPath remember the result of every collision
+   * check in a per query bitmap so no Node is checked twice
+   */
+  void Set_Collision_Memo(bool);
   /** findPath Plans the Path from Start to Goal Point */
   std::vector<Vec3i> findPath(Vec3i, Vec3i);
   /** Add_Collision adds the Nodes to Obstacle List */
   void Add_Collision(Vec3i);
+  /**
+   * Set_Occupancy sets a map, such as a Point_Cloud_Ingest Snapshot, whose
+   * Obstacles are checked in addition to the walls. Set it between queries,
+   * the map itself must not change while it is set. Returns false and sets
+   * no map if masks of passable moves are set, which skip the check.
+   */
+  bool Set_Occupancy(std::shared_ptr<const Occupancy_Map>);
+  /**
+   * Set_Snapshot sets a Snapshot_Map whose Obstacles are checked in
+   * addition to the walls. Each query reads one Snapshot when it starts and
+   * plans against it to the end, so the writer thread of the map may Set
+   * and Publish while queries run. Set it between queries. Returns false and
+   * sets no map if masks of passable moves are set, which skip the check.
+   */
+  bool Set_Snapshot(std::shared_ptr<const Snapshot_Map>);
+  /**
+   * Set_Goal_Bounding sets a table built from this Planner. findPath then
+   * skips every move whose box does not contain the Goal. Rebuild the table
+   * whenever the Obstacles change. Returns false and sets no table if it
+   * is empty, its World Size or number of Directions differ, or masks are
+   * set, since its boxes come from moves that may cut corners.
+   */
+  bool Set_Goal_Bounding(std::shared_ptr<const Goal_Bounding>);
+  /**
+   * Set_Passability sets masks built from this Planner. findPath then only
+   * expands the passable moves of each Node, without collision checks, and
+   * never cuts the corner of an Obstacle. Add_Collision updates the masks.
+   * Returns false and sets no masks if a Goal_Bounding table, whose boxes
+   * may cut corners, or an occupancy or Snapshot_Map, whose Obstacles the
+   * masks do not follow, is set.
+   */
+  bool Set_Passability(std::shared_ptr<Passability_Map>);
   /** Heuristic Function */
   std::function<double(Vec3i, Vec3i)> heuristic;
   /**
@@ -101,6 +180,21 @@ class Planner {
   std::vector<Vec3i> direction, walls;
   /** World_Size of return type Vec3i struct contains world dimensions */
   Vec3i World_Size;
+  /** occupancy contains Obstacle Nodes in addition to walls, may be null */
+  std::shared_ptr<const Occupancy_Map> occupancy;
+  /** snapshots contains Obstacle Nodes read once per query, may be null */
+  std::shared_ptr<const Snapshot_Map> snapshots;
+  /** bounding prunes the neighbors expanded by findPath, may be null */
+  std::shared_ptr<const Goal_Bounding> bounding;
+  /** passability gives the moves expanded by findPath, may be null */
+  std::shared_ptr<Passability_Map> passability;
+  /** Lazy_Collision and Collision_Memo select the collision check modes */
+  bool Lazy_Collision, Collision_Memo;
+  /**
+   * Collision_Checks counts the Nodes inside the World checked against the
+   * Obstacles by the last query
+   */
+  std::size_t Collision_Checks;
   virtual ~Planner();  ///< Destructor for Planner Class
 };
 
@@ -0,0 +1,114 @@
+/**
+ * @file Point_Cloud_Ingest.h
+ * @brief This file contains the declarations of variables and methods for
+ * Point_Cloud_Ingest class which turns batches of sensor points into
+ * Obstacle Nodes on its own thread. Updates go to a back Occupancy_Map which
+ * is then published, so planners always read a complete map and are never
+ * blocked by ingestion.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MID_TERM_A_STAR_3D_INCLUDE_POINT_CLOUD_INGEST_H_
+#define MID_TERM_A_STAR_3D_INCLUDE_POINT_CLOUD_INGEST_H_
+
+/* --Includes-- */
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "Grid_Geometry.h"
+#include "Occupancy_Map.h"
+
+/**
+ * @brief Point_Cloud_Ingest class declaration.
+ */
+class Point_Cloud_Ingest {
+  /** Private Access Specifier */
+
+  /** Batch of type Struct stores one scan waiting to be ingested */
+  struct Batch {
+    std::vector<Vec3d> Points;  ///< Points hit by the sensor
+    Vec3d Origin;  ///< Position of the sensor during the scan
+  };
+  /** Run is the body of the ingest thread */
+  void Run();
+  /** Clear_Ray clears the Nodes crossed by a ray with a 3D DDA */
+  void Clear_Ray(Vec3d, Vec3d, Occupancy_Map&, std::vector<std::size_t>*);
+
+  std::mutex Queue_Mutex;  ///< Guards Queue, Pending and Stopping
+  std::condition_variable Queue_Ready;  ///< Signals a new Batch or Stop
+  std::condition_variable Queue_Done;  ///< Signals an ingested Batch
+  std::deque<Batch> Queue;  ///< Batches waiting to be ingested
+  std::size_t Pending;  ///< Batches queued or being ingested
+  bool Stopping;  ///< Set by the destructor to end the ingest thread
+  /** Front is the published map, Back is written by the ingest thread */
+  std::shared_ptr<const Occupancy_Map> Front;
+  std::shared_ptr<Occupancy_Map> Back;
+  /** Lag stores the Nodes changed in Front but not yet in Back */
+  std::vector<std::size_t> Lag;
+  std::thread Worker;  ///< Ingest thread
+
+ public:  ///< Public Access Specifier
+  /**
+   * Constructor for Class Point_Cloud_Ingest. Starts the ingest thread with
+   * an empty map of the Discretized Workspace of the given Grid_Geometry.
+   */
+  explicit Point_Cloud_Ingest(const Grid_Geometry&,
+                              bool Clear_Free_Space_ = false,
+                              std::size_t Max_Queued_ = 8);
+  /**
+   * Push queues a scan and returns immediately. If Max_Queued scans are
+   * already waiting the oldest one is dropped.
+   */
+  void Push(std::vector<Vec3d>, Vec3d);
+  /** Flush waits until every pushed scan has been published */
+  void Flush();
+  /** Snapshot returns the latest published map, it never changes */
+  std::shared_ptr<const Occupancy_Map> Snapshot() const;
+  /**
+   * Apply voxelizes one scan, removes duplicate Nodes and marks them as
+   * Obstacles in the given map, clearing the free space first if enabled.
+   * Changed Nodes are appended to the optional list. Returns the number of
+   * distinct Obstacle Nodes of the scan.
+   */
+  std::size_t Apply(const std::vector<Vec3d>&, Vec3d, Occupancy_Map&,
+                    std::vector<std::size_t>* Changed_ = nullptr);
+  /** Geometry of type Grid_Geometry converts points to Nodes */
+  Grid_Geometry Geometry;
+  /** Clear_Free_Space enables clearing of Nodes between sensor and hits */
+  bool Clear_Free_Space;
+  /** Max_Queued is the number of scans which can wait to be ingested */
+  std::size_t Max_Queued;
+  /** Points, Batches and Dropped count ingested points and scans */
+  std::atomic<std::size_t> Points, Batches, Dropped;
+  virtual ~Point_Cloud_Ingest();  ///< Destructor for Point_Cloud_Ingest Class
+};
+
+#endif  // MID_TERM_A_STAR_3D_INCLUDE_POINT_CLOUD_INGEST_H_
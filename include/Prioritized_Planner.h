@@ -0,0 +1,67 @@
+/**
+ * @file Prioritized_Planner.h
+ * @brief This file contains the declarations of variables and methods for
+ * Prioritized_Planner class which plans a fleet of robots one after the
+ * other. Each robot is planned with Space_Time_Planner around the
+ * reservations of the robots planned before it.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MID_TERM_A_STAR_3D_INCLUDE_PRIORITIZED_PLANNER_H_
+#define MID_TERM_A_STAR_3D_INCLUDE_PRIORITIZED_PLANNER_H_
+
+/* --Includes-- */
+#include <cstddef>
+#include <vector>
+#include "Planner.h"
+#include "Reservation_Table.h"
+#include "Space_Time_Planner.h"
+
+/**
+ * @brief Declaration of Class Prioritized_Planner
+ */
+class Prioritized_Planner {
+ public:  ///< Public Access Specifier
+  /** Constructor for Class Prioritized_Planner */
+  explicit Prioritized_Planner(const Planner&);
+  /**
+   * findPaths Plans a path for each robot in the order given, which is the
+   * priority order. Paths are indexed by time step like
+   * Space_Time_Planner::findPath. A robot without a path gets an empty path
+   * and stays parked on its Start, so later robots go around it.
+   */
+  std::vector<std::vector<Vec3i>> findPaths(const std::vector<Vec3i>&,
+                                            const std::vector<Vec3i>&);
+  /** Single plans each robot */
+  Space_Time_Planner Single;
+  /** Table stores the reservations of the robots planned so far */
+  Reservation_Table Table;
+  /** Failed counts the robots without a path in the last findPaths */
+  std::size_t Failed;
+  virtual ~Prioritized_Planner();  ///< Destructor for Prioritized_Planner
+};
+
+#endif  // MID_TERM_A_STAR_3D_INCLUDE_PRIORITIZED_PLANNER_H_
@@ -0,0 +1,114 @@
+/**
+ * @file Reservation_Table.h
+ * @brief This file contains the declarations of variables and methods for
+ * Reservation_Table class which records the Nodes claimed by the paths of
+ * other agents over time. Reservations live in a single open addressing
+ * hash table of packed 64 bit keys, so lookups cost a few probes of a flat
+ * array however many agents are planned.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MID_TERM_A_STAR_3D_INCLUDE_RESERVATION_TABLE_H_
+#define MID_TERM_A_STAR_3D_INCLUDE_RESERVATION_TABLE_H_
+
+/* --Includes-- */
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Planner.h"
+
+/**
+ * @brief Reservation_Table class declaration. Three kinds of entries share
+ * the table, told apart by the lowest two bits of the key:
+ * a Node at a time step maps to the agent holding it, a Node maps to the
+ * time step from which an agent parks on it forever, and a Node maps to
+ * the last time step it is reserved at. Keys hold coordinates from 0 to
+ * Max_Coordinate and time steps from 0 to Max_Time. Reservations outside
+ * these limits are rejected, so lookups outside them find nothing.
+ */
+class Reservation_Table {
+  /** Private Access Specifier */
+
+  /** Key packs a Node, a time step and an entry kind */
+  static uint64_t Key(Vec3i, int, int);
+  /** In_Range returns true if a Node and time step fit in a key */
+  static bool In_Range(Vec3i, int);
+  /** Find returns the Slot of a key or the empty Slot where it belongs */
+  std::size_t Find(uint64_t) const;
+  /** Insert sets the value of a key, growing the table if needed */
+  void Insert(uint64_t, int32_t);
+  /** Lookup returns the value of a key or -1 */
+  int32_t Lookup(uint64_t) const;
+
+  /** Keys and Values of the Slots, kept apart so no padding is stored */
+  std::vector<uint64_t> Keys;
+  std::vector<int32_t> Values;
+  std::size_t Used;  ///< Number of occupied Slots
+  int Last;  ///< Last time step reserved by any agent
+
+ public:  ///< Public Access Specifier
+  /** Largest coordinate and time step a key can hold */
+  static const int Max_Coordinate = 0x7FFF, Max_Time = 0x1FFFF;
+  Reservation_Table();  ///< Constructor for Class Reservation_Table
+  /**
+   * Reserve claims a Node at a time step for an agent. Returns false and
+   * reserves nothing outside the limits of a key.
+   */
+  bool Reserve(Vec3i, int, int);
+  /**
+   * Reserve_Path claims every Node of a path indexed by time step (the
+   * first Node at the given start time) and parks the agent on the last
+   * Node from then on. Returns false and reserves nothing if a Node or
+   * time step lies outside the limits of a key.
+   */
+  bool Reserve_Path(const std::vector<Vec3i>&, int, int Start_Time_ = 0);
+  /** Owner returns the agent holding a Node at a time step, or -1 */
+  int Owner(Vec3i, int) const;
+  /** Is_Free returns true if no agent holds a Node at a time step */
+  bool Is_Free(Vec3i, int) const;
+  /**
+   * Can_Move returns true if a move from the first Node at a time step to
+   * the second Node at the next time step neither enters a held Node nor
+   * swaps places with another agent.
+   */
+  bool Can_Move(Vec3i, Vec3i, int) const;
+  /**
+   * Can_Park returns true if an agent can stay on a Node forever from a
+   * time step on.
+   */
+  bool Can_Park(Vec3i, int) const;
+  /** Last_Time returns the last time step reserved by any agent */
+  int Last_Time() const;
+  /** Size returns the number of entries in the table */
+  std::size_t Size() const;
+  /** Bytes returns the memory used by the table */
+  std::size_t Bytes() const;
+  /** Clear removes every reservation */
+  void Clear();
+  virtual ~Reservation_Table();  ///< Destructor for Reservation_Table Class
+};
+
+#endif  // MID_TERM_A_STAR_3D_INCLUDE_RESERVATION_TABLE_H_
@@ -0,0 +1,153 @@
+/**
+ * @file Snapshot_Map.h
+ * @brief This file contains the declaration of Snapshot_Map class, a
+ * chunked copy-on-write occupancy map which one writer updates while any
+ * number of readers plan on immutable snapshots without locks.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MID_TERM_A_STAR_3D_INCLUDE_SNAPSHOT_MAP_H_
+#define MID_TERM_A_STAR_3D_INCLUDE_SNAPSHOT_MAP_H_
+
+/* --Includes-- */
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "Planner.h"
+
+/**
+ * @brief Snapshot_Map class declaration. The World is split into chunks of
+ * 8x8x8 Nodes. A published Version is a list of pointers to immutable
+ * chunks, so a new Version copies only the chunks it changes and shares the
+ * others. Readers pin the current epoch in a reader slot while they hold a
+ * Snapshot, and the writer frees a retired Version or chunk only once every
+ * pinned epoch is newer than the epoch which retired it.
+ */
+class Snapshot_Map {
+ public:  ///< Public Access Specifier
+  /** Chunk_Bits is the number of bits of a coordinate inside a chunk */
+  static const int Chunk_Bits = 3;
+  /** Chunk of type array stores one byte per Node of a chunk */
+  typedef std::array<uint8_t, 1 << (3 * Chunk_Bits)> Chunk;
+  /** Version of type Struct is one published state of the map */
+  struct Version {
+    uint64_t Epoch;  ///< Epoch which published the Version
+    std::vector<const Chunk*> Chunks;  ///< Chunks, x varies fastest
+  };
+
+  /**
+   * @brief Snapshot class is a handle to the Version which was current when
+   * it was taken. The Version is not freed while the handle lives, so it
+   * must be released before the Snapshot_Map is destroyed.
+   */
+  class Snapshot : public Occupancy_View {
+   public:  ///< Public Access Specifier
+    Snapshot(Snapshot&&);  ///< Move Constructor, the moved from handle is empty
+    /**
+     * Is_Occupied returns true if the Node is an Obstacle or lies outside the
+     * World, same as Occupancy_Map::Is_Occupied
+     */
+    bool Is_Occupied(Vec3i) const;
+    /** Epoch returns the epoch of the Version */
+    uint64_t Epoch() const;
+    /** Release unpins the Version before the handle is destroyed */
+    void Release();
+    virtual ~Snapshot();  ///< Destructor releases the Version
+
+   private:  ///< Private Access Specifier
+    friend class Snapshot_Map;
+    Snapshot(const Snapshot_Map*, int, const Version*);
+    Snapshot(const Snapshot&) = delete;
+    Snapshot& operator=(const Snapshot&) = delete;
+    const Snapshot_Map *Map;  ///< Map the Version belongs to
+    int Slot;  ///< Reader slot pinning the Version, -1 if released
+    const Version *View;  ///< Pinned Version
+  };
+
+  /**
+   * Constructor for Class Snapshot_Map. Publishes an empty first Version.
+   * At most Max_Readers_ Snapshots can be held at once, further readers
+   * wait for a free slot.
+   */
+  explicit Snapshot_Map(Vec3i, int Max_Readers_ = 64);
+  /** Read returns a Snapshot of the current Version, it never takes a lock */
+  Snapshot Read() const;
+  /**
+   * Set and Clear change a Node of the next Version. They, Add_Walls,
+   * Publish and Reclaim must all be called from one writer thread.
+   */
+  void Set(Vec3i);
+  void Clear(Vec3i);
+  /** Add_Walls marks every Node of a Planner walls list as an Obstacle */
+  void Add_Walls(const std::vector<Vec3i>&);
+  /**
+   * Publish makes the changes visible to new Snapshots, retires the
+   * previous Version and the chunks it no longer shares, and reclaims what
+   * no reader can see any more. Returns the epoch of the current Version.
+   */
+  uint64_t Publish();
+  /** Reclaim frees retired memory no reader can see, returns the count */
+  std::size_t Reclaim();
+  /** Retired returns the number of Versions and chunks waiting to be freed */
+  std::size_t Retired() const;
+  /** World_Size of type Vec3i struct contains world dimensions */
+  Vec3i World_Size;
+  /** Chunks_Copied counts the chunks copied by the writer */
+  std::size_t Chunks_Copied;
+  virtual ~Snapshot_Map();  ///< Destructor for Class Snapshot_Map
+
+ private:  ///< Private Access Specifier
+  /** Locate gives the chunk and the position inside the chunk of a Node */
+  std::pair<std::size_t, std::size_t> Locate(Vec3i) const;
+  /** Write changes a Node of the draft, copying its chunk on first write */
+  void Write(Vec3i, uint8_t);
+
+  Vec3i Chunk_Count;  ///< Chunks along each axis
+  Chunk Zero;  ///< Chunk without Obstacles shared by every clean chunk
+  /** Current is the published Version, Global_Epoch is its epoch */
+  std::atomic<const Version*> Current;
+  std::atomic<uint64_t> Global_Epoch;
+  /** Readers stores the epoch pinned by each reader slot, 0 if free */
+  std::unique_ptr<std::atomic<uint64_t>[]> Readers;
+  int Max_Readers;  ///< Number of reader slots
+  /** Draft stores the chunks of the next Version, Dirty the copied ones */
+  std::vector<Chunk*> Draft;
+  std::vector<uint8_t> Dirty;
+  /** Replaced stores the chunks the next Version no longer shares */
+  std::vector<const Chunk*> Replaced;
+  /** Retired Versions and chunks with the epoch which retired them */
+  std::vector<std::pair<uint64_t, const Version*>> Retired_Versions;
+  std::vector<std::pair<uint64_t, const Chunk*>> Retired_Chunks;
+
+  Snapshot_Map(const Snapshot_Map&) = delete;
+  Snapshot_Map& operator=(const Snapshot_Map&) = delete;
+};
+
+#endif  // MID_TERM_A_STAR_3D_INCLUDE_SNAPSHOT_MAP_H_
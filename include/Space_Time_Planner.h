@@ -0,0 +1,84 @@
+/**
+ * @file Space_Time_Planner.h
+ * @brief This file contains the declarations of variables and methods for
+ * Space_Time_Planner class which plans over (x, y, z, t) with A*. Besides the
+ * 26 moves an agent may wait in place, and Nodes claimed by other agents in a
+ * Reservation_Table are avoided at the time steps they are claimed.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MID_TERM_A_STAR_3D_INCLUDE_SPACE_TIME_PLANNER_H_
+#define MID_TERM_A_STAR_3D_INCLUDE_SPACE_TIME_PLANNER_H_
+
+/* --Includes-- */
+#include <cstddef>
+#include <functional>
+#include <vector>
+#include "Planner.h"
+#include "Occupancy_Map.h"
+#include "Reservation_Table.h"
+
+/**
+ * @brief Declaration of Class Space_Time_Planner
+ */
+class Space_Time_Planner {
+ public:  ///< Public Access Specifier
+  /**
+   * Constructor for Class Space_Time_Planner. Copies the World Size,
+   * Obstacles, Directions and Heuristic of the given Planner.
+   */
+  explicit Space_Time_Planner(const Planner&);
+  /**
+   * findPath Plans the Path from Start to Goal Point starting at the given
+   * time step while avoiding the reservations. The returned path is indexed
+   * by time: path[i] is the Node at time step Start_Time_ + i, so waits
+   * repeat a Node. The path ends once the agent can park on the Goal for
+   * good. Returns an empty path if no such path exists within Max_Time,
+   * and at once if another agent holds the Start at the start time step or
+   * is parked on the Goal.
+   */
+  std::vector<Vec3i> findPath(Vec3i, Vec3i, const Reservation_Table&,
+                              int Start_Time_ = 0);
+  /** Heuristic Function */
+  std::function<double(Vec3i, Vec3i)> heuristic;
+  /** direction contains direction of movement from current to neighbor node */
+  std::vector<Vec3i> direction;
+  /** Map stores the Obstacle Nodes */
+  Occupancy_Map Map;
+  /** Wait_Cost is the cost of waiting one time step, same as a straight move */
+  int Wait_Cost;
+  /**
+   * Max_Time bounds the number of time steps of a path. When 0 the bound is
+   * the last reserved time step plus four times the sum of World Dimensions.
+   * Paths never go past Reservation_Table::Max_Time.
+   */
+  int Max_Time;
+  /** Expanded counts the states expanded by the last findPath */
+  std::size_t Expanded;
+  virtual ~Space_Time_Planner();  ///< Destructor for Space_Time_Planner Class
+};
+
+#endif  // MID_TERM_A_STAR_3D_INCLUDE_SPACE_TIME_PLANNER_H_
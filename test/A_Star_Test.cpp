@@ -177,3 +177,53 @@ TEST(Planner, Collision_Test) {
     EXPECT_NE((Coordinates[0] * Coordinates[1] * Coordinates[2]), 1);
   }
 }
+
+/**
+ * @brief Unit Test to Check whether Lazy and Memoized collision checking
+ * find paths of the same cost with fewer collision checks.
+ */
+TEST(Planner, Lazy_And_Memo_Collision_Test) {
+  Planner Wall_Plan = Planner({ World[0], World[1], World[2] });
+  Wall_Plan.Set_Heuristic(Planner::Octile);
+  for (int Counter_Y = 0; Counter_Y < 9; Counter_Y++) {
+    for (int Counter_Z = 0; Counter_Z < 10; Counter_Z++) {
+      Wall_Plan.Add_Collision({ 5, Counter_Y, Counter_Z });
+    }
+  }
+  auto Eager_Path = Wall_Plan.findPath({ 0, 0, 0 }, { 9, 0, 0 });
+  std::size_t Eager_Checks = Wall_Plan.Collision_Checks;
+  for (bool Lazy : { false, true }) {
+    for (bool Memo : { false, true }) {
+      Wall_Plan.Set_Lazy_Collision(Lazy);
+      Wall_Plan.Set_Collision_Memo(Memo);
+      auto path_3 = Wall_Plan.findPath({ 0, 0, 0 }, { 9, 0, 0 });
+      EXPECT_EQ(Planner::Path_Cost(path_3), Planner::Path_Cost(Eager_Path));
+      EXPECT_TRUE(path_3.front() == Vec3i({ 9, 0, 0 }));
+      if (Lazy || Memo) {
+        EXPECT_LT(Wall_Plan.Collision_Checks, Eager_Checks);
+      }
+      for (auto& coordinate : path_3) {
+        EXPECT_FALSE(coordinate.x == 5 && coordinate.y < 9);
+      }
+    }
+  }
+}
+
+/**
+ * @brief Unit Test to Check whether a lazy query without a path never ends
+ * its partial path on an Obstacle which was only checked when selected.
+ */
+TEST(Planner, Lazy_Collision_No_Path_Test) {
+  Planner Blocked_Plan = Planner({ 3, 1, 1 });
+  Blocked_Plan.Add_Collision({ 1, 0, 0 });
+  for (bool Memo : { false, true }) {
+    Blocked_Plan.Set_Lazy_Collision(true);
+    Blocked_Plan.Set_Collision_Memo(Memo);
+    auto path = Blocked_Plan.findPath({ 0, 0, 0 }, { 2, 0, 0 });
+    ASSERT_FALSE(path.empty());
+    for (auto& coordinate : path) {
+      EXPECT_FALSE(coordinate == Vec3i({ 1, 0, 0 }));
+    }
+    EXPECT_TRUE(path.back() == Vec3i({ 0, 0, 0 }));
+  }
+}
@@ -0,0 +1,156 @@
+/**
+ * @file Async_Planner_Test.cpp
+ * @brief Unit Tests of Async_Planner. Checks that committed prefixes begin
+ * the final path, cancellation and unreachable Goals.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* --Includes-- */
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <memory>
+#include <vector>
+#include "../include/Async_Planner.h"
+#include "../include/Integer_Planner.h"
+#include "../include/Planner.h"
+
+/**
+ * @brief Corridor_World builds a flat 12x11x1 Planner whose odd rows are
+ * walls with a gap at alternating ends, so one corridor winds through the
+ * World and the committed path can grow while the search runs
+ * @return Planner with the Obstacles
+ */
+static Planner Corridor_World() {
+  Planner Plan = Planner({ 12, 11, 1 });
+  for (int Counter_Y = 1; Counter_Y < 11; Counter_Y += 2) {
+    int Gap = (Counter_Y % 4 == 1) ? 11 : 0;
+    for (int Counter_X = 0; Counter_X < 12; Counter_X++) {
+      if (Counter_X != Gap) {
+        Plan.Add_Collision({ Counter_X, Counter_Y, 0 });
+      }
+    }
+  }
+  return Plan;
+}
+
+/**
+ * @brief Unit Test to Check whether every committed prefix begins the final
+ * path, the prefixes only grow and the final path is the synchronous one.
+ */
+TEST(Async_Planner, Committed_Prefixes_Begin_Final_Path) {
+  Planner Plan = Corridor_World();
+  Async_Planner Async(Plan);
+  Async.Commit_Interval = 8;
+  std::vector<std::vector<Vec3i>> Commits;
+  auto Query = Async.Submit({ 0, 0, 0 }, { 0, 10, 0 },
+                            [&](const std::vector<Vec3i>& prefix_) {
+                              Commits.push_back(prefix_);
+                            });
+  int Lower = 0, Upper = 0;
+  std::vector<Vec3i> Greedy = Query->Wait_Best(&Lower, &Upper);
+  ASSERT_GE(Greedy.size(), 2u);
+  EXPECT_EQ(Greedy.front(), (Vec3i{ 0, 0, 0 }));
+  EXPECT_EQ(Greedy.back(), (Vec3i{ 0, 10, 0 }));
+  EXPECT_LE(Lower, Upper);
+  std::vector<Vec3i> First = Query->Wait_Committed(2);
+  EXPECT_GE(First.size(), 2u);
+  std::vector<Vec3i> path = Query->Wait();
+  ASSERT_EQ(Query->Get_Status(), Async_Planner::Job::Found);
+  Integer_Planner Search(Plan);
+  std::vector<Vec3i> Expected = Search.findPath({ 0, 0, 0 }, { 0, 10, 0 });
+  std::reverse(Expected.begin(), Expected.end());
+  EXPECT_EQ(path, Expected);
+  EXPECT_EQ(Query->Best(&Lower, &Upper), path);
+  EXPECT_EQ(Lower, Search.Cost);
+  EXPECT_EQ(Upper, Search.Cost);
+  ASSERT_GT(Commits.size(), 2u);
+  EXPECT_EQ(Commits.back(), path);
+  for (std::size_t i = 0; i < Commits.size(); ++i) {
+    ASSERT_LE(Commits[i].size(), path.size());
+    EXPECT_TRUE(std::equal(Commits[i].begin(), Commits[i].end(),
+                           path.begin()));
+    if (i > 0) {
+      EXPECT_GT(Commits[i].size(), Commits[i - 1].size());
+    }
+  }
+  /** Some Nodes were committed while the search still ran */
+  EXPECT_LT(Commits[Commits.size() - 2].size(), path.size());
+  EXPECT_GT(Commits[Commits.size() - 2].size(), 5u);
+}
+
+/**
+ * @brief Unit Test to Check whether queued and running queries can be
+ * cancelled and unreachable Goals end the query.
+ */
+TEST(Async_Planner, Cancel_And_Unreachable) {
+  Planner Plan = Planner({ 40, 40, 20 });
+  for (int Counter_X = 0; Counter_X < 40; Counter_X++) {
+    for (int Counter_Y = 0; Counter_Y < 40; Counter_Y++) {
+      Plan.Add_Collision({ Counter_X, Counter_Y, 10 });
+    }
+  }
+  Async_Planner Async(Plan);
+  Async.Commit_Interval = 64;
+  auto Running = Async.Submit({ 0, 0, 0 }, { 39, 39, 19 });
+  auto Queued = Async.Submit({ 0, 0, 0 }, { 1, 1, 1 });
+  Queued->Cancel();
+  EXPECT_EQ(Queued->Get_Status(), Async_Planner::Job::Cancelled);
+  EXPECT_TRUE(Queued->Wait().empty());
+  Running->Wait_Committed(1);
+  Running->Cancel();
+  EXPECT_TRUE(Running->Wait().empty());
+  EXPECT_EQ(Running->Get_Status(), Async_Planner::Job::Cancelled);
+
+  auto Unreachable = Async.Submit({ 0, 0, 0 }, { 2, 2, 12 });
+  EXPECT_TRUE(Unreachable->Wait().empty());
+  EXPECT_EQ(Unreachable->Get_Status(), Async_Planner::Job::Not_Found);
+  auto Reachable = Async.Submit({ 0, 0, 0 }, { 2, 2, 2 });
+  EXPECT_EQ(Reachable->Wait().size(), 3u);
+}
+
+/**
+ * @brief Unit Test to Check whether a query cancelled between two commits
+ * is not published as found, even if its search finishes first.
+ */
+TEST(Async_Planner, Cancel_Between_Commits) {
+  Async_Planner Async(Corridor_World());
+  Async.Commit_Interval = 1 << 30;  ///< Progress never sees the Stop
+  std::promise<std::shared_ptr<Async_Planner::Job>> Submitted;
+  std::shared_future<std::shared_ptr<Async_Planner::Job>> Query(
+      Submitted.get_future());
+  std::atomic<int> Calls(0);
+  Submitted.set_value(Async.Submit({ 0, 0, 0 }, { 0, 10, 0 },
+      [&](const std::vector<Vec3i>&) {
+    if (Calls++ == 0) {
+      Query.get()->Cancel();  ///< Cancel once the query started
+    }
+  }));
+  EXPECT_TRUE(Query.get()->Wait().empty());
+  EXPECT_EQ(Query.get()->Get_Status(), Async_Planner::Job::Cancelled);
+  EXPECT_EQ(Calls.load(), 1);
+}
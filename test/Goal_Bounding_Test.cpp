@@ -0,0 +1,171 @@
+/**
+ * @file Goal_Bounding_Test.cpp
+ * @brief Unit Tests of Goal_Bounding. Checks that pruned queries stay
+ * optimal, that saved tables load back unchanged and that fewer Nodes are
+ * checked.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* --Includes-- */
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../include/Goal_Bounding.h"
+#include "../include/Planner.h"
+
+/**
+ * @brief Bounding_World builds a 10x10x4 Planner with two walls, each with a
+ * gap at an opposite end
+ * @return Planner with the Obstacles and Octile heuristic
+ */
+static Planner Bounding_World() {
+  Planner Plan = Planner({ 10, 10, 4 });
+  Plan.Set_Heuristic(Planner::Octile);
+  for (int Counter_Y = 0; Counter_Y < 10; Counter_Y++) {
+    for (int Counter_Z = 0; Counter_Z < 4; Counter_Z++) {
+      if (Counter_Y < 8) {
+        Plan.Add_Collision({ 3, Counter_Y, Counter_Z });
+      }
+      if (Counter_Y > 1) {
+        Plan.Add_Collision({ 6, Counter_Y, Counter_Z });
+      }
+    }
+  }
+  return Plan;
+}
+
+/**
+ * @brief Unit Test to Check whether queries pruned by the table find paths
+ * of the same cost as unpruned queries while checking fewer Nodes.
+ */
+TEST(Goal_Bounding, Pruned_Paths_Stay_Optimal) {
+  Planner Plan = Bounding_World();
+  auto Table = std::make_shared<Goal_Bounding>();
+  Table->Build(Plan, 2);
+  ASSERT_FALSE(Table->Empty());
+  EXPECT_LT(Table->Bytes(), Table->Raw_Bytes());
+  const std::vector<std::vector<Vec3i>> Queries = {
+    { { 0, 0, 0 }, { 9, 0, 3 } }, { { 9, 9, 0 }, { 0, 0, 0 } },
+    { { 4, 4, 2 }, { 5, 0, 0 } }, { { 0, 9, 3 }, { 8, 9, 0 } } };
+  for (auto& query : Queries) {
+    Plan.Set_Goal_Bounding(nullptr);
+    auto path_1 = Plan.findPath(query[0], query[1]);
+    std::size_t Full_Checks = Plan.Collision_Checks;
+    Plan.Set_Goal_Bounding(Table);
+    auto path_2 = Plan.findPath(query[0], query[1]);
+    EXPECT_EQ(Planner::Path_Cost(path_2), Planner::Path_Cost(path_1));
+    EXPECT_TRUE(path_2.front() == query[1]);
+    EXPECT_TRUE(path_2.back() == query[0]);
+    EXPECT_LT(Plan.Collision_Checks, Full_Checks);
+  }
+}
+
+/**
+ * @brief Unit Test to Check whether a saved table maps back with the same
+ * boxes and whether invalid files are rejected.
+ */
+TEST(Goal_Bounding, Save_And_Load) {
+  Planner Plan = Bounding_World();
+  Goal_Bounding Built;
+  Built.Build(Plan);
+  const char *Temp = std::getenv("TMPDIR");
+  std::string Directory = std::string((Temp != nullptr && *Temp != 0)
+      ? Temp : "/tmp") + "/goal_bounding_XXXXXX";
+  ASSERT_NE(mkdtemp(&Directory[0]), nullptr);
+  std::string File = Directory + "/table.bin";
+  ASSERT_TRUE(Built.Save(File));
+  Goal_Bounding Loaded;
+  ASSERT_TRUE(Loaded.Load(File));
+  EXPECT_EQ(Loaded.Palette_Size, Built.Palette_Size);
+  EXPECT_EQ(Loaded.Bytes(), Built.Bytes());
+  for (int Counter_X = 0; Counter_X < 10; Counter_X++) {
+    for (int Direction = 0; Direction < 26; Direction++) {
+      Vec3i Node_ = { Counter_X, 9 - Counter_X, Counter_X % 4 };
+      EXPECT_EQ(Loaded.Allows(Node_, Direction, { 9, 0, 0 }),
+                Built.Allows(Node_, Direction, { 9, 0, 0 }));
+      EXPECT_EQ(Loaded.Box(Node_, Direction).Max[1],
+                Built.Box(Node_, Direction).Max[1]);
+    }
+  }
+  /** An index past the palette, the file size still matches */
+  std::FILE *Corrupt = std::fopen(File.c_str(), "r+b");
+  ASSERT_NE(Corrupt, nullptr);
+  std::fseek(Corrupt, -4, SEEK_END);
+  const uint32_t Past_Palette = 0xFFFFFFFF;
+  std::fwrite(&Past_Palette, sizeof(Past_Palette), 1, Corrupt);
+  std::fclose(Corrupt);
+  EXPECT_FALSE(Loaded.Load(File));
+  EXPECT_TRUE(Loaded.Empty());
+  std::FILE *Truncated = std::fopen(File.c_str(), "wb");
+  std::fputs("AGB1", Truncated);
+  std::fclose(Truncated);
+  EXPECT_FALSE(Loaded.Load(File));
+  EXPECT_TRUE(Loaded.Empty());
+  std::remove(File.c_str());
+  rmdir(Directory.c_str());
+}
+
+/**
+ * @brief Unit Test to Check whether a Planner rejects tables built for
+ * another World or set of Directions.
+ */
+TEST(Goal_Bounding, Rejects_Mismatched_Table) {
+  Planner Plan = Bounding_World();
+  auto Table = std::make_shared<Goal_Bounding>();
+  EXPECT_FALSE(Plan.Set_Goal_Bounding(Table));  ///< Nothing built yet
+  Table->Build(Plan, 1);
+  EXPECT_TRUE(Plan.Set_Goal_Bounding(Table));
+  Planner Larger = Planner({ 12, 10, 4 });
+  EXPECT_FALSE(Larger.Set_Goal_Bounding(Table));
+  EXPECT_EQ(Larger.bounding, nullptr);
+  Planner Fewer = Bounding_World();
+  Fewer.direction.resize(6);
+  EXPECT_FALSE(Fewer.Set_Goal_Bounding(Table));
+  EXPECT_TRUE(Plan.Set_Goal_Bounding(nullptr));
+}
+
+/**
+ * @brief Unit Test to Check whether Build refuses Planners whose World or
+ * Directions do not fit the table, instead of truncating them.
+ */
+TEST(Goal_Bounding, Refuses_Oversized_Planner) {
+  Planner Wide = Planner({ 0x10000, 1, 1 });
+  auto Table = std::make_shared<Goal_Bounding>();
+  Table->Build(Wide, 1);
+  EXPECT_TRUE(Table->Empty());
+  Planner Many = Planner({ 2, 2, 1 });
+  Many.direction.resize(257, Vec3i({ 1, 0, 0 }));
+  Table->Build(Many, 1);
+  EXPECT_TRUE(Table->Empty());
+  EXPECT_FALSE(Many.Set_Goal_Bounding(Table));
+  Table->Build(Bounding_World(), 1);
+  EXPECT_FALSE(Table->Empty());
+}
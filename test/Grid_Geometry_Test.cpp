@@ -0,0 +1,137 @@
+/**
+ * @file Grid_Geometry_Test.cpp
+ * @brief Unit tests for Implementation of Grid_Geometry Class.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* --Includes-- */
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../include/Build_Map.h"
+#include "../include/Grid_Geometry.h"
+
+/** Geometry of the World used by the Build_Map tests, built at compile time */
+constexpr Grid_Geometry Geometry({{0.0, 0.0, 0.0}, {10.0, 10.0, 10.0}}, 1, 1,
+                                 0.1);
+static_assert(Geometry.World.x == 10 && Geometry.World.z == 10,
+              "World Dimensions are computed at compile time");
+static_assert(Geometry.To_Cell({2.5, 2.0, 9.99}).z == 9,
+              "Points are converted at compile time");
+static_assert(Geometry.Obstacle_Cells({{5, 0, 0}, {5, 10, 10}}).Min.x == 4,
+              "Obstacles are converted at compile time");
+
+/**
+ * @brief Unit Test to Check whether the value API gives the same Nodes and
+ * points as the vector API of Build_Map.
+ */
+TEST(Grid_Geometry, Matches_Build_Map) {
+  Build_Map Map = Build_Map({ -1.0, -5.0, 0.0, 10.0, 20.0, 6.0 }, 0.25, 0.5,
+                            0.2);
+  std::vector<int> Built_Node = Map.Build_Node({ 3.9, 6.4, 0.7 });
+  Vec3i Cell = Map.Geometry.To_Cell({3.9, 6.4, 0.7});
+  EXPECT_EQ(Built_Node, std::vector<int>({ Cell.x, Cell.y, Cell.z }));
+  EXPECT_EQ(Built_Node, std::vector<int>({ 19, 45, 1 }));
+  std::vector<int> Extrema = Map.Build_Obstacle({ 0, 2, 0, 10, 2.5, 1.5 });
+  EXPECT_EQ(Extrema, std::vector<int>({ 3, 27, 0, 44, 31, 4 }));
+  Vec3d Point = Map.Geometry.To_Point({ 4, 8, 2 });
+  EXPECT_EQ(Map.Get_Coordinate({ 4, 8, 2 }),
+            std::vector<double>({ Point.x, Point.y, Point.z }));
+  EXPECT_EQ(Map.World, std::vector<int>({ Map.Geometry.World.x,
+    Map.Geometry.World.y, Map.Geometry.World.z }));
+  EXPECT_EQ(Map.Boundary[3], Map.Geometry.Boundary.Max.x);
+  EXPECT_EQ(Map.xy_res, Map.Geometry.Resolution.x);
+  EXPECT_EQ(Map.z_res, Map.Geometry.Resolution.z);
+}
+
+/** Callers cannot write a Build_Map member that Geometry would not follow */
+static_assert(!std::is_assignable<decltype(
+    (std::declval<Build_Map&>().xy_res)), double>::value,
+    "Build_Map members are read only");
+
+/**
+ * @brief Unit Test to Check whether points exactly on a cell boundary land
+ * in the same Node as the division used by Build_Map before Grid_Geometry,
+ * for a resolution which is not a power of two.
+ */
+TEST(Grid_Geometry, Boundary_Points_Match_Division) {
+  Build_Map Map = Build_Map({ 0.0, 0.0, 0.0, 1.0, 1.0, 1.0 }, 0.1, 0.1, 0);
+  /** 0.3 / 0.1 is just below 3 while 0.3 * (1 / 0.1) is just above */
+  EXPECT_EQ(Map.Build_Node({ 0.3, 0.6, 0.7 }), std::vector<int>({
+      static_cast<int>(0.3 / 0.1), static_cast<int>(0.6 / 0.1),
+      static_cast<int>(0.7 / 0.1) }));
+  EXPECT_EQ(Map.Build_Obstacle({ 0.3, 0.6, 0.7, 0.3, 0.6, 0.7 }),
+            std::vector<int>({ static_cast<int>(std::floor(0.3 / 0.1)),
+                static_cast<int>(std::floor(0.6 / 0.1)),
+                static_cast<int>(std::floor(0.7 / 0.1)),
+                static_cast<int>(std::ceil(0.3 / 0.1)),
+                static_cast<int>(std::ceil(0.6 / 0.1)),
+                static_cast<int>(std::ceil(0.7 / 0.1)) }));
+  std::vector<Vec3d> Points;
+  for (int i = 0; i <= 10; ++i) {
+    Points.push_back({ i * 0.1, 0.3, 0.6 });
+  }
+  std::vector<Vec3i> Cells(Points.size());
+  Map.Geometry.To_Cells(Points.data(), Points.size(), Cells.data());
+  for (std::size_t i = 0; i < Points.size(); ++i) {
+    Vec3i Expected = { static_cast<int>(Points[i].x / 0.1),
+      static_cast<int>(0.3 / 0.1), static_cast<int>(0.6 / 0.1) };
+    EXPECT_TRUE(Cells[i] == Expected) << i;
+    EXPECT_TRUE(Map.Geometry.To_Cell(Points[i]) == Expected) << i;
+  }
+}
+
+/**
+ * @brief Unit Test to Check whether the batched SIMD conversions give the
+ * same results as converting one point at a time, including the tail of
+ * arrays whose length is not a multiple of the SIMD width.
+ */
+TEST(Grid_Geometry, Batched_Matches_Scalar) {
+  Grid_Geometry World({{-3.0, 1.5, -2.0}, {40.0, 30.0, 12.0}}, 0.1, 0.3, 0);
+  std::mt19937 Generator(7);
+  std::uniform_real_distribution<double> Uniform(0.0, 1.0);
+  std::vector<Vec3d> Points(1027);
+  for (auto& point : Points) {
+    point = {-3.0 + 43.0 * Uniform(Generator),
+             1.5 + 28.5 * Uniform(Generator),
+             -2.0 + 14.0 * Uniform(Generator)};
+  }
+  std::vector<Vec3i> Cells(Points.size());
+  World.To_Cells(Points.data(), Points.size(), Cells.data());
+  std::vector<Vec3d> Back(Points.size());
+  World.To_Points(Cells.data(), Cells.size(), Back.data());
+  for (std::size_t i = 0; i < Points.size(); ++i) {
+    Vec3i Cell = World.To_Cell(Points[i]);
+    EXPECT_TRUE(Cells[i] == Cell);
+    Vec3d Point = World.To_Point(Cell);
+    EXPECT_DOUBLE_EQ(Back[i].x, Point.x);
+    EXPECT_DOUBLE_EQ(Back[i].y, Point.y);
+    EXPECT_DOUBLE_EQ(Back[i].z, Point.z);
+  }
+}
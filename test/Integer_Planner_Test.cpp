@@ -0,0 +1,133 @@
+/**
+ * @file Integer_Planner_Test.cpp
+ * @brief Unit Tests of Integer_Planner. Checks optimal costs, plateau
+ * expansion and bit-identical paths across runs and builds.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* --Includes-- */
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "../include/Integer_Planner.h"
+#include "../include/Planner.h"
+
+/**
+ * @brief Maze_World builds a 12x12x6 Planner with three offset walls
+ * @return Planner with the Obstacles and Octile heuristic
+ */
+static Planner Maze_World() {
+  Planner Plan = Planner({ 12, 12, 6 });
+  Plan.Set_Heuristic(Planner::Octile);
+  for (int Counter_Y = 0; Counter_Y < 12; Counter_Y++) {
+    for (int Counter_Z = 0; Counter_Z < 6; Counter_Z++) {
+      if (Counter_Y < 9 || Counter_Z > 3) {
+        Plan.Add_Collision({ 3, Counter_Y, Counter_Z });
+      }
+      if (Counter_Y > 2 || Counter_Z < 2) {
+        Plan.Add_Collision({ 6, Counter_Y, Counter_Z });
+      }
+      if ((Counter_Y + Counter_Z) % 5 != 0) {
+        Plan.Add_Collision({ 9, Counter_Y, Counter_Z });
+      }
+    }
+  }
+  return Plan;
+}
+
+/**
+ * @brief Path_Hash hashes the Nodes of a path with 64 bit FNV-1a
+ * @param path_ has type vector of Vec3i
+ * @return hash of type uint64_t
+ */
+static uint64_t Path_Hash(const std::vector<Vec3i>& path_) {
+  uint64_t Hash = 14695981039346656037ULL;
+  for (const Vec3i& node : path_) {
+    for (int Value : { node.x, node.y, node.z }) {
+      Hash = (Hash ^ static_cast<uint64_t>(Value)) * 1099511628211ULL;
+    }
+  }
+  return Hash;
+}
+
+/**
+ * @brief Unit Test to Check whether the integer search finds paths of the
+ * same cost as Planner::findPath with the Octile heuristic.
+ */
+TEST(Integer_Planner, Optimal_Cost) {
+  Planner Plan = Maze_World();
+  Integer_Planner Search(Plan);
+  const std::vector<std::vector<Vec3i>> Queries = {
+    { { 0, 0, 0 }, { 11, 11, 5 } }, { { 11, 0, 5 }, { 0, 11, 0 } },
+    { { 4, 4, 4 }, { 8, 1, 3 } } };
+  for (auto& query : Queries) {
+    auto path_1 = Search.findPath(query[0], query[1]);
+    ASSERT_FALSE(path_1.empty());
+    EXPECT_TRUE(path_1.front() == query[1]);
+    EXPECT_TRUE(path_1.back() == query[0]);
+    EXPECT_EQ(Search.Cost, Planner::Path_Cost(path_1));
+    EXPECT_EQ(Search.Cost, Planner::Path_Cost(Plan.findPath(query[0],
+                                                            query[1])));
+  }
+  Planner Closed = Planner({ 4, 4, 1 });
+  for (int Counter_Y = 0; Counter_Y < 4; Counter_Y++) {
+    Closed.Add_Collision({ 2, Counter_Y, 0 });
+  }
+  Integer_Planner Blocked(Closed);
+  EXPECT_TRUE(Blocked.findPath({ 0, 0, 0 }, { 3, 3, 0 }).empty());
+  EXPECT_EQ(Blocked.Cost, -1);
+}
+
+/**
+ * @brief Unit Test to Check whether ties preferring the higher G value walk
+ * straight through the plateau of an empty World.
+ */
+TEST(Integer_Planner, Plateau_Expansion) {
+  Integer_Planner Search(Planner({ 20, 20, 20 }));
+  auto path_1 = Search.findPath({ 0, 0, 0 }, { 19, 13, 7 });
+  EXPECT_EQ(Search.Cost, Integer_Planner::Heuristic({ 0, 0, 0 },
+                                                    { 19, 13, 7 }));
+  EXPECT_EQ(Search.Expanded, path_1.size() - 1);
+}
+
+/**
+ * @brief Unit Test to Check whether runs on fresh planners, with different
+ * heap layouts, give bit-identical paths and expansions, and whether they
+ * match the values recorded for every build.
+ */
+TEST(Integer_Planner, Bit_Identical_Paths) {
+  Planner Plan = Maze_World();
+  std::vector<std::unique_ptr<Integer_Planner>> Planners;
+  std::vector<std::unique_ptr<std::vector<char>>> Padding;
+  for (int Run = 0; Run < 4; ++Run) {
+    Padding.emplace_back(new std::vector<char>(1000 * (Run + 1)));
+    Planners.emplace_back(new Integer_Planner(Plan));
+    auto path_1 = Planners.back()->findPath({ 0, 0, 0 }, { 11, 11, 5 });
+    EXPECT_EQ(Path_Hash(path_1), 1224989119412592683ULL);
+    EXPECT_EQ(Planners.back()->Expanded, 345u);
+  }
+}
@@ -0,0 +1,135 @@
+/**
+ * @file Multi_Resolution_Planner_Test.cpp
+ * @brief Unit Tests of Multi_Resolution_Planner. Checks the occupancy
+ * pyramid, the coarse to fine paths and the full resolution fallback.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* --Includes-- */
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <vector>
+#include "../include/Multi_Resolution_Planner.h"
+#include "../include/Planner.h"
+
+/**
+ * @brief Unit Test to Check whether every level halves the World, stops
+ * halving an axis of one Node and covers every finer Obstacle.
+ */
+TEST(Multi_Resolution_Planner, Pyramid_Is_Conservative) {
+  Planner Plan = Planner({ 10, 6, 2 });
+  Plan.Add_Collision({ 9, 5, 1 });
+  Plan.Add_Collision({ 4, 0, 0 });
+  Multi_Resolution_Planner Multi(Plan);
+  ASSERT_EQ(Multi.Levels.size(), 5u);
+  EXPECT_TRUE(Multi.Levels[1].World_Size == Vec3i({ 5, 3, 1 }));
+  EXPECT_TRUE(Multi.Levels[2].World_Size == Vec3i({ 3, 2, 1 }));
+  EXPECT_TRUE(Multi.Scale[2] == Vec3i({ 4, 4, 2 }));
+  EXPECT_TRUE(Multi.Levels[4].World_Size == Vec3i({ 1, 1, 1 }));
+  for (std::size_t Level = 1; Level < Multi.Levels.size(); ++Level) {
+    EXPECT_TRUE(Multi.Levels[Level].Is_Occupied({
+      9 / Multi.Scale[Level].x, 5 / Multi.Scale[Level].y,
+      1 / Multi.Scale[Level].z }));
+    EXPECT_TRUE(Multi.Levels[Level].Is_Occupied({
+      4 / Multi.Scale[Level].x, 0, 0 }));
+  }
+  EXPECT_FALSE(Multi.Levels[1].Is_Occupied({ 1, 1, 0 }));
+}
+
+/**
+ * @brief Unit Test to Check whether levels of a World with a z_res twice
+ * its xy_res coarsen x and y first and all three axes once Nodes are cubes.
+ */
+TEST(Multi_Resolution_Planner, Separate_xy_And_z_Levels) {
+  Planner Plan = Planner({ 8, 8, 8 });
+  Plan.Add_Collision({ 7, 7, 7 });
+  Multi_Resolution_Planner Multi(Plan, 0, 0.1, 0.2);
+  ASSERT_EQ(Multi.Levels.size(), 5u);
+  EXPECT_TRUE(Multi.Scale[1] == Vec3i({ 2, 2, 1 }));
+  EXPECT_TRUE(Multi.Levels[1].World_Size == Vec3i({ 4, 4, 8 }));
+  EXPECT_TRUE(Multi.Scale[2] == Vec3i({ 4, 4, 2 }));
+  EXPECT_TRUE(Multi.Scale[4] == Vec3i({ 8, 8, 8 }));
+  EXPECT_TRUE(Multi.Levels[1].Is_Occupied({ 3, 3, 7 }));
+  EXPECT_FALSE(Multi.Levels[1].Is_Occupied({ 3, 3, 6 }));
+  auto path = Multi.findPath({ 0, 0, 0 }, { 7, 7, 6 });
+  ASSERT_FALSE(path.empty());
+  EXPECT_EQ(Planner::Path_Cost(path),
+            Planner::Path_Cost(Plan.findPath({ 0, 0, 0 }, { 7, 7, 6 })));
+}
+
+/**
+ * @brief Unit Test to Check whether the coarse to fine path avoids the
+ * Obstacles and stays close to the cost of Planner::findPath.
+ */
+TEST(Multi_Resolution_Planner, Corridor_Path) {
+  Planner Plan = Planner({ 16, 16, 4 });
+  Plan.Set_Heuristic(Planner::Octile);
+  for (int Counter_Y = 0; Counter_Y < 12; Counter_Y++) {
+    for (int Counter_Z = 0; Counter_Z < 4; Counter_Z++) {
+      Plan.Add_Collision({ 8, Counter_Y, Counter_Z });
+    }
+  }
+  Multi_Resolution_Planner Multi(Plan);
+  auto path_1 = Multi.findPath({ 0, 0, 0 }, { 15, 0, 3 });
+  ASSERT_FALSE(path_1.empty());
+  EXPECT_EQ(Multi.Used_Level, 2);
+  EXPECT_TRUE(path_1.front() == Vec3i({ 15, 0, 3 }));
+  EXPECT_TRUE(path_1.back() == Vec3i({ 0, 0, 0 }));
+  for (std::size_t i = 0; i < path_1.size(); ++i) {
+    EXPECT_FALSE(Multi.Levels[0].Is_Occupied(path_1[i]));
+    if (i > 0) {
+      EXPECT_LE(std::abs(path_1[i].x - path_1[i - 1].x), 1);
+      EXPECT_LE(std::abs(path_1[i].y - path_1[i - 1].y), 1);
+      EXPECT_LE(std::abs(path_1[i].z - path_1[i - 1].z), 1);
+    }
+  }
+  double Optimal = Planner::Path_Cost(Plan.findPath({ 0, 0, 0 },
+                                                    { 15, 0, 3 }));
+  EXPECT_GE(Planner::Path_Cost(path_1), Optimal);
+  EXPECT_LE(Planner::Path_Cost(path_1), 1.1 * Optimal);
+}
+
+/**
+ * @brief Unit Test to Check whether a gap closed by pooling falls back to
+ * finer levels and still finds the optimal path.
+ */
+TEST(Multi_Resolution_Planner, Fallback_Through_Narrow_Gap) {
+  Planner Plan = Planner({ 12, 12, 1 });
+  Plan.Set_Heuristic(Planner::Octile);
+  for (int Counter_Y = 0; Counter_Y < 12; Counter_Y++) {
+    if (Counter_Y != 6) {
+      Plan.Add_Collision({ 5, Counter_Y, 0 });
+    }
+  }
+  Multi_Resolution_Planner Multi(Plan);
+  auto path_1 = Multi.findPath({ 0, 0, 0 }, { 11, 11, 0 });
+  EXPECT_EQ(Multi.Used_Level, 0);
+  EXPECT_EQ(Planner::Path_Cost(path_1),
+            Planner::Path_Cost(Plan.findPath({ 0, 0, 0 }, { 11, 11, 0 })));
+  Plan.Add_Collision({ 5, 6, 0 });
+  Multi_Resolution_Planner Blocked(Plan);
+  EXPECT_TRUE(Blocked.findPath({ 0, 0, 0 }, { 11, 11, 0 }).empty());
+}
@@ -0,0 +1,101 @@
+/**
+ * @file Parallel_Planner_Test.cpp
+ * @brief Unit tests for Implementation of Parallel_Planner Class. Paths are
+ * checked against the serial Planner.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* --Includes-- */
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <vector>
+#include "../include/Planner.h"
+#include "../include/Parallel_Planner.h"
+
+/**
+ * @brief Wall_World builds a 10x10x10 Planner with a wall at x = 5 which
+ * has a single hole at y = 8, z = 2.
+ * @return Planner with Octile heuristic
+ */
+static Planner Wall_World() {
+  Planner Plan = Planner({ 10, 10, 10 });
+  Plan.Set_Heuristic(Planner::Octile);
+  for (int Counter_Y = 0; Counter_Y < 10; Counter_Y++) {
+    for (int Counter_Z = 0; Counter_Z < 10; Counter_Z++) {
+      if (Counter_Y != 8 || Counter_Z != 2) {
+        Plan.Add_Collision({ 5, Counter_Y, Counter_Z });
+      }
+    }
+  }
+  return Plan;
+}
+
+/**
+ * @brief Unit Test to Check whether the Parallel Path costs as much as the
+ * Serial Path for any number of threads.
+ */
+TEST(Parallel_Planner, Same_Cost_As_Serial) {
+  Planner Plan = Wall_World();
+  auto Serial_Path = Plan.findPath({ 0, 0, 0 }, { 9, 1, 9 });
+  Parallel_Planner Parallel_Plan(Plan);
+  for (int Threads : { 1, 2, 4, 8 }) {
+    auto path = Parallel_Plan.findPath({ 0, 0, 0 }, { 9, 1, 9 }, Threads);
+    EXPECT_EQ(Planner::Path_Cost(Serial_Path), Planner::Path_Cost(path));
+  }
+}
+
+/**
+ * @brief Unit Test to Check whether the Parallel Path runs from Goal to
+ * Start through free neighboring Nodes.
+ */
+TEST(Parallel_Planner, Valid_Path) {
+  Planner Plan = Wall_World();
+  Parallel_Planner Parallel_Plan(Plan);
+  auto path = Parallel_Plan.findPath({ 0, 0, 0 }, { 9, 1, 9 }, 4);
+  ASSERT_FALSE(path.empty());
+  EXPECT_TRUE(path.front() == Vec3i({ 9, 1, 9 }));
+  EXPECT_TRUE(path.back() == Vec3i({ 0, 0, 0 }));
+  for (std::size_t i = 0; i < path.size(); ++i) {
+    EXPECT_FALSE(Parallel_Plan.Map.Is_Occupied(path[i]));
+    if (i > 0) {
+      EXPECT_LE(std::abs(path[i].x - path[i - 1].x), 1);
+      EXPECT_LE(std::abs(path[i].y - path[i - 1].y), 1);
+      EXPECT_LE(std::abs(path[i].z - path[i - 1].z), 1);
+    }
+  }
+}
+
+/**
+ * @brief Unit Test to Check whether an unreachable Goal gives an empty path
+ * and a Goal equal to the Start gives a single Node.
+ */
+TEST(Parallel_Planner, Unreachable_And_Trivial_Goal) {
+  Planner Plan = Wall_World();
+  Plan.Add_Collision({ 5, 8, 2 });
+  Parallel_Planner Parallel_Plan(Plan);
+  EXPECT_TRUE(Parallel_Plan.findPath({ 0, 0, 0 }, { 9, 1, 9 }, 4).empty());
+  EXPECT_EQ(Parallel_Plan.findPath({ 3, 3, 3 }, { 3, 3, 3 }, 4).size(), 1u);
+}
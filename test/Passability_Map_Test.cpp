@@ -0,0 +1,190 @@
+/**
+ * @file Passability_Map_Test.cpp
+ * @brief Unit tests of Passability_Map, the masks built in parallel and
+ * updated on Add_Collision, and findPath over the masks.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* --Includes-- */
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+#include "../include/Goal_Bounding.h"
+#include "../include/Occupancy_Map.h"
+#include "../include/Passability_Map.h"
+#include "../include/Planner.h"
+#include "../include/Snapshot_Map.h"
+
+/**
+ * @brief Sweeps_Free checks a move the slow way, every Node of the unit
+ * cube crossed by the move has to be free
+ * @param Map_ of type Occupancy_Map stores the Obstacles
+ * @param From_ of type Vec3i struct stores the Node the move starts at
+ * @param Move_ of type Vec3i struct stores the move
+ * @return true if the move is passable
+ */
+static bool Sweeps_Free(const Occupancy_Map& Map_, Vec3i From_, Vec3i Move_) {
+  if (Map_.Is_Occupied(From_)) {
+    return false;
+  }
+  for (int Axes = 1; Axes < 8; ++Axes) {
+    if (Map_.Is_Occupied({ From_.x + ((Axes & 1) ? Move_.x : 0),
+        From_.y + ((Axes & 2) ? Move_.y : 0),
+        From_.z + ((Axes & 4) ? Move_.z : 0) })) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Unit Test to Check whether a diagonal move between two Obstacles
+ * is blocked while the destination test alone allows it.
+ */
+TEST(Passability_Map, Blocks_Corner_Cutting) {
+  Planner Plan = Planner({ 3, 3, 3 });
+  Plan.Add_Collision({ 2, 1, 1 });
+  Passability_Map Masks(Plan, 1);
+  Vec3i Center = { 1, 1, 1 };
+  for (int i = 0; i < 26; ++i) {
+    const Vec3i& move = Plan.direction[i];
+    /** Only the moves crossing the Obstacle at x + 1 are blocked */
+    EXPECT_EQ(Masks.Allows(Center, i), move.x != 1) << i;
+  }
+  EXPECT_EQ(Masks.Mask({ 2, 1, 1 }), 0u);
+  EXPECT_EQ(Masks.Mask({ 3, 1, 1 }), 0u);
+  /** Corner of the World, only the 7 moves into the World remain */
+  EXPECT_EQ(__builtin_popcount(Masks.Mask({ 0, 0, 0 })), 7);
+}
+
+/**
+ * @brief Unit Test to Check whether masks built with several threads and
+ * masks updated by Add_Collision match a brute force check of every move.
+ */
+TEST(Passability_Map, Parallel_Build_And_Updates_Match) {
+  Planner Plan = Planner({ 9, 7, 5 });
+  std::srand(7);
+  for (int Obstacle = 0; Obstacle < 40; ++Obstacle) {
+    Plan.Add_Collision({ std::rand() % 9, std::rand() % 7, std::rand() % 5 });
+  }
+  auto Masks = std::make_shared<Passability_Map>(Plan, 3);
+  Plan.Set_Passability(Masks);
+  for (int Obstacle = 0; Obstacle < 40; ++Obstacle) {
+    Plan.Add_Collision({ std::rand() % 9, std::rand() % 7, std::rand() % 5 });
+  }
+  Passability_Map Rebuilt(Plan, 1);
+  EXPECT_EQ(Masks->Masks, Rebuilt.Masks);
+  for (std::size_t Cell = 0; Cell < Rebuilt.Map.Size(); ++Cell) {
+    Vec3i coordinates = Rebuilt.Map.Coordinates(Cell);
+    for (int i = 0; i < 26; ++i) {
+      ASSERT_EQ(Rebuilt.Allows(coordinates, i),
+                Sweeps_Free(Rebuilt.Map, coordinates, Plan.direction[i]));
+    }
+  }
+  Masks->Clear({ 0, 0, 0 });
+  EXPECT_NE(Masks->Mask({ 0, 0, 0 }), 0u);
+}
+
+/**
+ * @brief Unit Test to Check whether findPath over the masks goes around a
+ * diagonal gap which the collision checks let it squeeze through, without
+ * any collision check.
+ */
+TEST(Passability_Map, findPath_Does_Not_Cut_Corners) {
+  Planner Plan = Planner({ 4, 4, 1 });
+  Plan.Set_Heuristic(Planner::Octile);
+  /** Two Obstacles touching at a corner, the free diagonal (1,1)-(2,2) */
+  Plan.Add_Collision({ 2, 1, 0 });
+  Plan.Add_Collision({ 1, 2, 0 });
+  std::vector<Vec3i> Cutting = Plan.findPath({ 1, 1, 0 }, { 2, 2, 0 });
+  EXPECT_EQ(Cutting.size(), 2u);
+  Plan.Set_Passability(std::make_shared<Passability_Map>(Plan));
+  std::vector<Vec3i> path = Plan.findPath({ 1, 1, 0 }, { 2, 2, 0 });
+  EXPECT_EQ(Plan.Collision_Checks, 0u);
+  ASSERT_GT(path.size(), 2u);
+  EXPECT_TRUE(path.front() == (Vec3i{ 2, 2, 0 }));
+  EXPECT_TRUE(path.back() == (Vec3i{ 1, 1, 0 }));
+  for (std::size_t i = 1; i < path.size(); ++i) {
+    Vec3i Move = { path[i - 1].x - path[i].x, path[i - 1].y - path[i].y,
+      path[i - 1].z - path[i].z };
+    EXPECT_TRUE(Sweeps_Free(Plan.passability->Map, path[i], Move));
+  }
+}
+
+/**
+ * @brief Unit Test to Check whether masks and a Goal_Bounding table, whose
+ * boxes come from moves that cut corners, are never set together, so the
+ * corner free path found with the masks is kept.
+ */
+TEST(Passability_Map, Rejects_Goal_Bounding) {
+  Planner Plan = Planner({ 4, 4, 1 });
+  Plan.Set_Heuristic(Planner::Octile);
+  Plan.Add_Collision({ 2, 1, 0 });
+  Plan.Add_Collision({ 1, 2, 0 });
+  auto Table = std::make_shared<Goal_Bounding>();
+  Table->Build(Plan, 1);
+  auto Masks = std::make_shared<Passability_Map>(Plan);
+  EXPECT_TRUE(Plan.Set_Passability(Masks));
+  EXPECT_FALSE(Plan.Set_Goal_Bounding(Table));
+  EXPECT_EQ(Plan.bounding, nullptr);
+  std::vector<Vec3i> path = Plan.findPath({ 1, 1, 0 }, { 2, 2, 0 });
+  ASSERT_GT(path.size(), 2u);
+  EXPECT_TRUE(path.front() == (Vec3i{ 2, 2, 0 }));
+  EXPECT_TRUE(Plan.Set_Passability(nullptr));
+  EXPECT_TRUE(Plan.Set_Goal_Bounding(Table));
+  EXPECT_FALSE(Plan.Set_Passability(Masks));
+  EXPECT_EQ(Plan.passability, nullptr);
+  EXPECT_EQ(Plan.findPath({ 1, 1, 0 }, { 2, 2, 0 }).size(), 2u);
+}
+
+/**
+ * @brief Unit Test to Check whether masks are never set together with a
+ * Snapshot_Map or an occupancy map, whose Obstacles findPath over the masks
+ * would go straight through.
+ */
+TEST(Passability_Map, Rejects_Dynamic_Maps) {
+  Planner Plan = Planner({ 3, 1, 1 });
+  std::shared_ptr<Snapshot_Map> Snapshots(new Snapshot_Map({ 3, 1, 1 }));
+  Snapshots->Set({ 1, 0, 0 });
+  Snapshots->Publish();
+  auto Masks = std::make_shared<Passability_Map>(Plan);
+  EXPECT_TRUE(Plan.Set_Snapshot(Snapshots));
+  EXPECT_FALSE(Plan.Set_Passability(Masks));
+  EXPECT_EQ(Plan.passability, nullptr);
+  EXPECT_FALSE(Plan.findPath({ 0, 0, 0 }, { 2, 0, 0 }).front()
+      == (Vec3i{ 2, 0, 0 }));
+  EXPECT_TRUE(Plan.Set_Snapshot(nullptr));
+  EXPECT_TRUE(Plan.Set_Passability(Masks));
+  EXPECT_FALSE(Plan.Set_Snapshot(Snapshots));
+  EXPECT_EQ(Plan.snapshots, nullptr);
+  auto Occupancy = std::make_shared<Occupancy_Map>(Vec3i{ 3, 1, 1 });
+  EXPECT_FALSE(Plan.Set_Occupancy(Occupancy));
+  EXPECT_EQ(Plan.occupancy, nullptr);
+  EXPECT_TRUE(Plan.Set_Passability(nullptr));
+  EXPECT_TRUE(Plan.Set_Occupancy(Occupancy));
+  EXPECT_FALSE(Plan.Set_Passability(Masks));
+}
@@ -0,0 +1,138 @@
+/**
+ * @file Point_Cloud_Ingest_Test.cpp
+ * @brief Unit tests for Implementation of Point_Cloud_Ingest Class.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* --Includes-- */
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+#include "../include/Occupancy_Map.h"
+#include "../include/Planner.h"
+#include "../include/Point_Cloud_Ingest.h"
+
+/** Geometry of a 10x10x10 World with unit resolution */
+static const Grid_Geometry Geometry({{0.0, 0.0, 0.0}, {10.0, 10.0, 10.0}},
+                                    1, 1, 0);
+
+/**
+ * @brief Unit Test to Check whether a scan is voxelized once per Node and
+ * published after Flush.
+ */
+TEST(Point_Cloud_Ingest, Voxelize_And_Publish) {
+  Point_Cloud_Ingest Ingest(Geometry);
+  Occupancy_Map Map(Geometry.World);
+  EXPECT_EQ(Ingest.Apply({ {2.2, 3.5, 4.9}, {2.7, 3.1, 4.0}, {11, 0, 0} },
+                         {0, 0, 0}, Map), 1u);
+  EXPECT_TRUE(Map.Is_Occupied({ 2, 3, 4 }));
+
+  Ingest.Push({ {5.5, 5.5, 5.5}, {5.2, 5.9, 5.1}, {1.5, 1.5, 1.5} },
+              {0, 0, 0});
+  Ingest.Flush();
+  auto Snapshot = Ingest.Snapshot();
+  EXPECT_TRUE(Snapshot->Is_Occupied({ 5, 5, 5 }));
+  EXPECT_TRUE(Snapshot->Is_Occupied({ 1, 1, 1 }));
+  EXPECT_FALSE(Snapshot->Is_Occupied({ 2, 3, 4 }));
+  EXPECT_EQ(Ingest.Points.load(), 3u);
+}
+
+/**
+ * @brief Unit Test to Check whether a held Snapshot never changes while
+ * later scans are published.
+ */
+TEST(Point_Cloud_Ingest, Snapshot_Is_Immutable) {
+  Point_Cloud_Ingest Ingest(Geometry);
+  Ingest.Push({ {1.5, 1.5, 1.5} }, {0, 0, 0});
+  Ingest.Flush();
+  auto Held = Ingest.Snapshot();
+  for (int i = 2; i < 9; ++i) {
+    Ingest.Push({ {i + 0.5, 1.5, 1.5} }, {0, 0, 0});
+  }
+  Ingest.Flush();
+  EXPECT_TRUE(Held->Is_Occupied({ 1, 1, 1 }));
+  EXPECT_FALSE(Held->Is_Occupied({ 5, 1, 1 }));
+  auto Latest = Ingest.Snapshot();
+  for (int i = 1; i < 9; ++i) {
+    EXPECT_TRUE(Latest->Is_Occupied({ i, 1, 1 }));
+  }
+}
+
+/**
+ * @brief Unit Test to Check whether ray clearing frees the Nodes between the
+ * sensor and a hit but keeps the hit.
+ */
+TEST(Point_Cloud_Ingest, Ray_Clearing) {
+  Point_Cloud_Ingest Ingest(Geometry, true);
+  Occupancy_Map Map(Geometry.World);
+  for (int i = 0; i < 10; ++i) {
+    Map.Set({ i, 2, 2 });
+  }
+  Map.Set({ 4, 5, 2 });
+  Ingest.Apply({ {8.5, 2.5, 2.5} }, {0.5, 2.5, 2.5}, Map);
+  for (int i = 0; i < 8; ++i) {
+    EXPECT_FALSE(Map.Is_Occupied({ i, 2, 2 }));
+  }
+  EXPECT_TRUE(Map.Is_Occupied({ 8, 2, 2 }));
+  EXPECT_TRUE(Map.Is_Occupied({ 9, 2, 2 }));
+  EXPECT_TRUE(Map.Is_Occupied({ 4, 5, 2 }));
+}
+
+/**
+ * @brief Unit Test to Check whether the Planner avoids Obstacles of a
+ * Snapshot set with Set_Occupancy.
+ */
+TEST(Point_Cloud_Ingest, Planner_Uses_Snapshot) {
+  Point_Cloud_Ingest Ingest(Geometry);
+  Ingest.Push({ {1.5, 1.5, 1.5} }, {0, 0, 0});
+  Ingest.Flush();
+  Planner Plan = Planner(Geometry.World);
+  Plan.Set_Occupancy(Ingest.Snapshot());
+  auto path = Plan.findPath({ 0, 0, 0 }, { 2, 2, 2 });
+  ASSERT_FALSE(path.empty());
+  for (auto& coordinate : path) {
+    EXPECT_FALSE(coordinate == Vec3i({ 1, 1, 1 }));
+  }
+}
+
+/**
+ * @brief Unit Test to Check whether Occupancy_Map::Add_Obstacles copies an
+ * occupancy map of another World Size without reading past it, Nodes
+ * outside it counting as Obstacles like in Planner::findPath.
+ */
+TEST(Point_Cloud_Ingest, Add_Obstacles_Of_Smaller_Map) {
+  auto Small = std::make_shared<Occupancy_Map>(Vec3i{ 2, 2, 2 });
+  Small->Set({ 1, 0, 0 });
+  Planner Plan = Planner({ 4, 3, 2 });
+  Plan.Set_Occupancy(Small);
+  Occupancy_Map Map({ 4, 3, 2 });
+  Map.Add_Obstacles(Plan);
+  EXPECT_FALSE(Map.Is_Occupied({ 0, 0, 0 }));
+  EXPECT_TRUE(Map.Is_Occupied({ 1, 0, 0 }));
+  EXPECT_FALSE(Map.Is_Occupied({ 1, 1, 1 }));
+  EXPECT_TRUE(Map.Is_Occupied({ 2, 0, 0 }));
+  EXPECT_TRUE(Map.Is_Occupied({ 0, 2, 1 }));
+}
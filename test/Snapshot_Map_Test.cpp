@@ -0,0 +1,160 @@
+/**
+ * @file Snapshot_Map_Test.cpp
+ * @brief Unit Tests of Snapshot_Map. Checks snapshot isolation, chunk
+ * sharing and reclamation, and stresses one writer against many readers.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* --Includes-- */
+#include <gtest/gtest.h>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "../include/Snapshot_Map.h"
+
+/**
+ * @brief Unit Test to Check whether a held Snapshot keeps its Version, only
+ * changed chunks are copied and retired memory is freed once released.
+ */
+TEST(Snapshot_Map, Isolation_And_Reclaim) {
+  Snapshot_Map Map({ 20, 20, 10 });
+  Map.Set({ 1, 1, 1 });
+  EXPECT_EQ(Map.Publish(), 2u);
+  EXPECT_EQ(Map.Chunks_Copied, 1u);
+  Snapshot_Map::Snapshot Old = Map.Read();
+  Map.Clear({ 1, 1, 1 });
+  Map.Set({ 2, 1, 1 });
+  Map.Set({ 19, 19, 9 });
+  EXPECT_EQ(Map.Publish(), 3u);
+  EXPECT_EQ(Map.Chunks_Copied, 3u);
+  EXPECT_EQ(Map.Publish(), 3u);  ///< Nothing changed, nothing published
+  EXPECT_EQ(Old.Epoch(), 2u);
+  EXPECT_TRUE(Old.Is_Occupied({ 1, 1, 1 }));
+  EXPECT_FALSE(Old.Is_Occupied({ 19, 19, 9 }));
+  EXPECT_TRUE(Old.Is_Occupied({ 20, 0, 0 }));
+  {
+    Snapshot_Map::Snapshot New = Map.Read();
+    EXPECT_EQ(New.Epoch(), 3u);
+    EXPECT_FALSE(New.Is_Occupied({ 1, 1, 1 }));
+    EXPECT_TRUE(New.Is_Occupied({ 2, 1, 1 }));
+    EXPECT_TRUE(New.Is_Occupied({ 19, 19, 9 }));
+  }
+  EXPECT_EQ(Map.Reclaim(), 0u);
+  EXPECT_EQ(Map.Retired(), 2u);  ///< First Version and the replaced chunk
+  Old.Release();
+  EXPECT_EQ(Map.Reclaim(), 2u);
+  EXPECT_EQ(Map.Retired(), 0u);
+}
+
+/**
+ * @brief Stress Test with readers taking Snapshots while the writer keeps
+ * publishing. Two Nodes in different chunks always change together, so
+ * every consistent Snapshot sees them equal.
+ */
+TEST(Snapshot_Map, Concurrent_Readers_Stress) {
+  Snapshot_Map Map({ 32, 32, 8 }, 4);
+  std::atomic<bool> Done(false);
+  std::atomic<int> Torn(0), Reads(0);
+  std::vector<std::thread> Threads;
+  for (int Reader = 0; Reader < 3; ++Reader) {
+    Threads.emplace_back([&]() {
+      uint64_t Last = 0;
+      while (!Done.load()) {
+        Snapshot_Map::Snapshot View = Map.Read();
+        if (View.Is_Occupied({ 0, 0, 0 }) != View.Is_Occupied({ 31, 31, 7 })
+            || View.Epoch() < Last) {
+          ++Torn;
+        }
+        Last = View.Epoch();
+        ++Reads;
+      }
+    });
+  }
+  for (int Round = 0; Round < 3000; ++Round) {
+    if (Round % 2 == 0) {
+      Map.Set({ 0, 0, 0 });
+      Map.Set({ 31, 31, 7 });
+    } else {
+      Map.Clear({ 0, 0, 0 });
+      Map.Clear({ 31, 31, 7 });
+    }
+    Map.Set({ Round % 32, 16, Round % 8 });
+    Map.Publish();
+    if (Round % 64 == 0) {
+      std::this_thread::yield();
+    }
+  }
+  Done.store(true);
+  for (auto& thread : Threads) {
+    thread.join();
+  }
+  EXPECT_EQ(Torn.load(), 0);
+  EXPECT_GT(Reads.load(), 0);
+  Map.Reclaim();
+  EXPECT_EQ(Map.Retired(), 0u);
+  EXPECT_EQ(Map.Read().Epoch(), 3001u);
+}
+
+/**
+ * @brief Test findPath on a Snapshot while the writer keeps publishing. The
+ * wall at x = 2 has its gap at y = 5 or at y = 0, both Nodes change in one
+ * Version, so every path must pass one of the two Versions as a whole.
+ */
+TEST(Snapshot_Map, Planner_Reads_One_Version) {
+  std::shared_ptr<Snapshot_Map> Map(new Snapshot_Map({ 6, 6, 1 }));
+  for (int y = 0; y < 5; ++y) {
+    Map->Set({ 2, y, 0 });
+  }
+  Map->Publish();
+  std::atomic<bool> Done(false);
+  std::thread Writer([&]() {
+    for (int Round = 0; !Done.load(); ++Round) {
+      Map->Set({ 2, Round % 2 == 0 ? 5 : 0, 0 });
+      Map->Clear({ 2, Round % 2 == 0 ? 0 : 5, 0 });
+      Map->Publish();
+    }
+  });
+  Planner Plan({ 6, 6, 1 });
+  Plan.Set_Snapshot(Map);
+  int Bad = 0;
+  for (int Query = 0; Query < 200; ++Query) {
+    std::vector<Vec3i> path = Plan.findPath({ 0, 0, 0 }, { 5, 0, 0 });
+    bool Low = false, High = false;  ///< Path uses the gap at y = 0 or 5
+    for (const Vec3i& step : path) {
+      Low = Low || (step.x == 2 && step.y == 0);
+      High = High || (step.x == 2 && step.y == 5);
+    }
+    if (path.empty() || !(path.front() == Vec3i{ 5, 0, 0 }) || Low == High) {
+      ++Bad;
+    }
+  }
+  Done.store(true);
+  Writer.join();
+  EXPECT_EQ(Bad, 0);
+  Map->Reclaim();
+  EXPECT_EQ(Map->Retired(), 0u);
+}
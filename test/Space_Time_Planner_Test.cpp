@@ -0,0 +1,217 @@
+/**
+ * @file Space_Time_Planner_Test.cpp
+ * @brief Unit tests for Implementation of Reservation_Table,
+ * Space_Time_Planner and Prioritized_Planner Classes.
+ *
+ * @author Vaibhav Bhilare
+ * @copyright 2017, Vaibhav Bhilare
+ *
+ * MIT License
+ * Copyright (c) 2017 Vaibhav Bhilare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* --Includes-- */
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <vector>
+#include "../include/Planner.h"
+#include "../include/Prioritized_Planner.h"
+#include "../include/Reservation_Table.h"
+#include "../include/Space_Time_Planner.h"
+
+/**
+ * @brief At gives the Node of a time indexed path at a time step, robots
+ * stay on their last Node
+ * @param path_ is the path
+ * @param Time_ is the time step
+ * @return Node at the time step
+ */
+static Vec3i At(const std::vector<Vec3i>& path_, std::size_t Time_) {
+  return path_[std::min(Time_, path_.size() - 1)];
+}
+
+/**
+ * @brief Unit Test to Check whether reservations, parking and swaps are
+ * reported and survive the table growing.
+ */
+TEST(Reservation_Table, Reserve_And_Lookup) {
+  Reservation_Table Table;
+  Table.Reserve_Path({ { 0, 0, 0 }, { 1, 0, 0 }, { 2, 0, 0 } }, 7);
+  EXPECT_EQ(Table.Owner({ 1, 0, 0 }, 1), 7);
+  EXPECT_TRUE(Table.Is_Free({ 1, 0, 0 }, 2));
+  EXPECT_EQ(Table.Owner({ 2, 0, 0 }, 500), 7);  ///< Parked on its Goal
+  EXPECT_FALSE(Table.Can_Park({ 1, 0, 0 }, 1));
+  EXPECT_TRUE(Table.Can_Park({ 1, 0, 0 }, 2));
+  EXPECT_FALSE(Table.Can_Move({ 1, 0, 0 }, { 0, 0, 0 }, 0));  ///< Swap
+  EXPECT_TRUE(Table.Can_Move({ 1, 1, 0 }, { 0, 0, 0 }, 0));
+
+  for (int i = 0; i < 20000; ++i) {
+    Table.Reserve({ i % 40, i / 40, 3 }, i % 17, i);
+  }
+  EXPECT_EQ(Table.Owner({ 1, 0, 0 }, 1), 7);
+  for (int i = 0; i < 20000; ++i) {
+    ASSERT_EQ(Table.Owner({ i % 40, i / 40, 3 }, i % 17), i);
+  }
+  EXPECT_EQ(Table.Last_Time(), 16);
+}
+
+/**
+ * @brief Unit Test to Check whether Nodes and time steps which do not fit a
+ * key are rejected instead of aliasing Nodes and time steps which do.
+ */
+TEST(Reservation_Table, Rejects_Out_Of_Range) {
+  Reservation_Table Table;
+  const int Limit = Reservation_Table::Max_Coordinate;
+  EXPECT_FALSE(Table.Reserve({ Limit + 1, 0, 0 }, 0, 1));
+  EXPECT_FALSE(Table.Reserve({ 0, 0, 0 }, Reservation_Table::Max_Time + 1,
+                             2));
+  EXPECT_FALSE(Table.Reserve({ 0, -1, 0 }, 0, 3));
+  EXPECT_FALSE(Table.Reserve_Path({ { 0, 0, 0 }, { 1, 0, 0 } }, 4,
+                                  Reservation_Table::Max_Time));
+  EXPECT_EQ(Table.Size(), 0u);
+  EXPECT_TRUE(Table.Is_Free({ 0, 0, 0 }, 0));
+  EXPECT_TRUE(Table.Reserve({ Limit, Limit, Limit },
+                            Reservation_Table::Max_Time, 5));
+  EXPECT_EQ(Table.Owner({ Limit, Limit, Limit },
+                        Reservation_Table::Max_Time), 5);
+  EXPECT_EQ(Table.Owner({ Limit + 1, Limit, Limit },
+                        Reservation_Table::Max_Time), -1);
+  EXPECT_TRUE(Table.Is_Free({ Limit, Limit, Limit }, 0));
+}
+
+/**
+ * @brief Unit Test to Check whether the space time path costs as much as the
+ * Planner path when nothing is reserved.
+ */
+TEST(Space_Time_Planner, Same_Cost_Without_Reservations) {
+  Planner Plan = Planner({ 8, 8, 8 });
+  Plan.Set_Heuristic(Planner::Octile);
+  for (int i = 0; i < 7; ++i) {
+    for (int j = 0; j < 8; ++j) {
+      Plan.Add_Collision({ 4, i, j });
+    }
+  }
+  Space_Time_Planner Space_Time(Plan);
+  Reservation_Table Table;
+  auto path = Space_Time.findPath({ 0, 0, 0 }, { 7, 0, 7 }, Table);
+  auto Serial_Path = Plan.findPath({ 0, 0, 0 }, { 7, 0, 7 });
+  ASSERT_FALSE(path.empty());
+  EXPECT_TRUE(path.front() == Vec3i({ 0, 0, 0 }));
+  EXPECT_TRUE(path.back() == Vec3i({ 7, 0, 7 }));
+  EXPECT_EQ(Planner::Path_Cost(path), Planner::Path_Cost(Serial_Path));
+}
+
+/**
+ * @brief Unit Test to Check whether a robot waits for another one crossing
+ * the only opening of a wall.
+ */
+TEST(Space_Time_Planner, Waits_For_Reservation) {
+  Planner Plan = Planner({ 3, 3, 1 });
+  Plan.Set_Heuristic(Planner::Octile);
+  Plan.Add_Collision({ 1, 0, 0 });
+  Plan.Add_Collision({ 1, 2, 0 });
+  Reservation_Table Table;
+  /** Another robot sits in the opening at time steps 1 and 2 */
+  Table.Reserve_Path({ { 1, 1, 0 }, { 1, 1, 0 }, { 1, 1, 0 }, { 2, 2, 0 } },
+                     0);
+  Space_Time_Planner Space_Time(Plan);
+  auto path = Space_Time.findPath({ 0, 1, 0 }, { 2, 1, 0 }, Table);
+  ASSERT_FALSE(path.empty());
+  EXPECT_TRUE(path.back() == Vec3i({ 2, 1, 0 }));
+  for (std::size_t t = 0; t < path.size(); ++t) {
+    EXPECT_TRUE(Table.Is_Free(path[t], static_cast<int>(t)));
+  }
+  EXPECT_GE(path.size(), 5u);  ///< Had to wait at least two time steps
+}
+
+/**
+ * @brief Unit Test to Check whether a held Start or a parked Goal is
+ * rejected and a path never ends on a Goal reserved later.
+ */
+TEST(Space_Time_Planner, Respects_Reserved_Start_And_Goal) {
+  Planner Plan = Planner({ 4, 1, 1 });
+  Reservation_Table Table;
+  Table.Reserve({ 0, 0, 0 }, 0, 0);
+  Table.Reserve({ 3, 0, 0 }, 6, 0);
+  Space_Time_Planner Space_Time(Plan);
+  EXPECT_TRUE(Space_Time.findPath({ 0, 0, 0 }, { 2, 0, 0 }, Table).empty());
+  auto path = Space_Time.findPath({ 1, 0, 0 }, { 3, 0, 0 }, Table);
+  ASSERT_FALSE(path.empty());
+  EXPECT_TRUE(path.back() == Vec3i({ 3, 0, 0 }));
+  EXPECT_GT(path.size(), 7u);  ///< Arrives after the reservation at step 6
+  Table.Reserve_Path({ { 2, 0, 0 } }, 1);
+  EXPECT_TRUE(Space_Time.findPath({ 1, 0, 0 }, { 2, 0, 0 }, Table).empty());
+  EXPECT_EQ(Space_Time.Expanded, 0u);
+}
+
+/**
+ * @brief Unit Test to Check whether a robot without a path stays parked on
+ * its Start, so the next robot goes around it.
+ */
+TEST(Prioritized_Planner, Parks_Failed_Robot) {
+  Planner Plan = Planner({ 3, 3, 1 });
+  Plan.Add_Collision({ 2, 2, 0 });
+  Prioritized_Planner Fleet(Plan);
+  auto paths = Fleet.findPaths({ { 1, 1, 0 }, { 0, 1, 0 } },
+                               { { 2, 2, 0 }, { 2, 1, 0 } });
+  EXPECT_EQ(Fleet.Failed, 1u);
+  EXPECT_TRUE(paths[0].empty());
+  ASSERT_FALSE(paths[1].empty());
+  EXPECT_TRUE(paths[1].back() == Vec3i({ 2, 1, 0 }));
+  for (const Vec3i& step : paths[1]) {
+    EXPECT_FALSE(step == Vec3i({ 1, 1, 0 }));
+  }
+}
+
+/**
+ * @brief Unit Test to Check whether the robots of a fleet never share a Node
+ * at a time step and never swap places.
+ */
+TEST(Prioritized_Planner, Conflict_Free_Fleet) {
+  Planner Plan = Planner({ 6, 3, 2 });
+  Plan.Set_Heuristic(Planner::Octile);
+  std::vector<Vec3i> Starts, Goals;
+  for (int i = 0; i < 3; ++i) {
+    Starts.push_back({ 0, i, 0 });
+    Goals.push_back({ 5, 2 - i, 1 - i % 2 });
+    Starts.push_back({ 5, i, 0 });
+    Goals.push_back({ 0, i, 1 });
+  }
+  Prioritized_Planner Fleet(Plan);
+  auto paths = Fleet.findPaths(Starts, Goals);
+  EXPECT_EQ(Fleet.Failed, 0u);
+  std::size_t Horizon = 0;
+  for (std::size_t i = 0; i < paths.size(); ++i) {
+    ASSERT_FALSE(paths[i].empty());
+    EXPECT_TRUE(paths[i].front() == Starts[i]);
+    EXPECT_TRUE(paths[i].back() == Goals[i]);
+    Horizon = std::max(Horizon, paths[i].size());
+  }
+  for (std::size_t t = 0; t < Horizon; ++t) {
+    for (std::size_t i = 0; i < paths.size(); ++i) {
+      for (std::size_t j = i + 1; j < paths.size(); ++j) {
+        EXPECT_FALSE(At(paths[i], t) == At(paths[j], t));
+        EXPECT_FALSE(At(paths[i], t) == At(paths[j], t + 1)
+                     && At(paths[i], t + 1) == At(paths[j], t));
+      }
+    }
+  }
+}